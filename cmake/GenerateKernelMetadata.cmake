@@ -27,12 +27,27 @@ set(PLATFORM_INFO "${OS_NAME}-${OS_PLATFORM}")
 
 # Generate appropriate flags based on backend
 if(${BACKEND} STREQUAL "cuda")
-    set(PROFILE_FLAG "-capability")
+    set(PROFILE_FLAGS_JSON ", \"-capability\", \"${PROFILE}\"")
+    set(PROFILE_FLAGS "-capability ${PROFILE} ")
     set(ENTRY_POINT "computeMain")
     set(EXTRA_FLAGS_JSON ", \"-D\", \"CUDA_BACKEND\"")
     set(EXTRA_FLAGS "-D CUDA_BACKEND")
+elseif(${BACKEND} STREQUAL "cpu")
+    set(PROFILE_FLAGS_JSON "")
+    set(PROFILE_FLAGS "")
+    set(ENTRY_POINT "computeMain")
+    set(EXTRA_FLAGS_JSON ", \"-D\", \"CPU_BACKEND\", \"-O3\"")
+    set(EXTRA_FLAGS "-D CPU_BACKEND -O3")
+    if(${PROFILE} STREQUAL "host-avx2")
+        string(APPEND EXTRA_FLAGS_JSON ", \"-Xgenericcpp\", \"-march=x86-64-v3\"")
+        string(APPEND EXTRA_FLAGS " -Xgenericcpp -march=x86-64-v3")
+    elseif(${PROFILE} STREQUAL "host-avx512")
+        string(APPEND EXTRA_FLAGS_JSON ", \"-Xgenericcpp\", \"-march=x86-64-v4\"")
+        string(APPEND EXTRA_FLAGS " -Xgenericcpp -march=x86-64-v4")
+    endif()
 else()
-    set(PROFILE_FLAG "-profile")
+    set(PROFILE_FLAGS_JSON ", \"-profile\", \"${PROFILE}\"")
+    set(PROFILE_FLAGS "-profile ${PROFILE} ")
     set(ENTRY_POINT "main")
     set(EXTRA_FLAGS_JSON "")
     set(EXTRA_FLAGS "")
@@ -46,7 +61,7 @@ set(METADATA_CONTENT "{
   \"backend\": \"${BACKEND}\",
   \"profile\": \"${PROFILE}\",
   \"target\": \"${TARGET}\",
-  \"slang_flags\": [\"-target\", \"${TARGET}\", \"${PROFILE_FLAG}\", \"${PROFILE}\", \"-stage\", \"compute\", \"-entry\", \"${ENTRY_POINT}\"${EXTRA_FLAGS_JSON}],
+  \"slang_flags\": [\"-target\", \"${TARGET}\"${PROFILE_FLAGS_JSON}, \"-stage\", \"compute\", \"-entry\", \"${ENTRY_POINT}\"${EXTRA_FLAGS_JSON}],
   \"source_file\": \"${SOURCE_FILE}\",
   \"output_file\": \"${OUTPUT_FILE}\",
   \"input_hash\": \"${INPUT_HASH}\",
@@ -57,7 +72,7 @@ set(METADATA_CONTENT "{
     \"platform\": \"${PLATFORM_INFO}\"
   },
   \"educational_notes\": {
-    \"manual_compilation\": \"slangc -target ${TARGET} ${PROFILE_FLAG} ${PROFILE} -stage compute -entry ${ENTRY_POINT} ${EXTRA_FLAGS} -o ${OUTPUT_FILE} ${SOURCE_FILE}\",
+    \"manual_compilation\": \"slangc -target ${TARGET} ${PROFILE_FLAGS}-stage compute -entry ${ENTRY_POINT} ${EXTRA_FLAGS} -o ${OUTPUT_FILE} ${SOURCE_FILE}\",
     \"target_description\": \"${TARGET} bytecode for ${BACKEND} backend with ${PROFILE} capability\"
   }
 }")
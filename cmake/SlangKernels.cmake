@@ -6,8 +6,24 @@
 set(SLANG_TARGETS
     "vulkan:glsl_450:spirv"
     "cuda:cuda_sm_7_0:ptx"
+    "cpu:host:shader-sharedlib"
 )
 
+# Host kernels are also built per x86-64 SIMD level so the compiler can vectorize
+# across a workgroup's invocations; the CPU backend loads the widest one the machine runs.
+# The -march levels need GCC 11 or Clang 12, so a level is only built when the compiler accepts it
+if(CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|amd64")
+    include(CheckCXXCompilerFlag)
+    check_cxx_compiler_flag(-march=x86-64-v3 KERNTOPIA_HAS_MARCH_X86_64_V3)
+    check_cxx_compiler_flag(-march=x86-64-v4 KERNTOPIA_HAS_MARCH_X86_64_V4)
+    if(KERNTOPIA_HAS_MARCH_X86_64_V3)
+        list(APPEND SLANG_TARGETS "cpu:host-avx2:shader-sharedlib")
+    endif()
+    if(KERNTOPIA_HAS_MARCH_X86_64_V4)
+        list(APPEND SLANG_TARGETS "cpu:host-avx512:shader-sharedlib")
+    endif()
+endif()
+
 # Create kernel output directory
 set(KERNEL_OUTPUT_DIR ${CMAKE_BINARY_DIR}/kernels)
 file(MAKE_DIRECTORY ${KERNEL_OUTPUT_DIR})
@@ -33,6 +49,9 @@ function(compile_slang_kernel KERNEL_NAME KERNEL_SOURCE_DIR)
             set(OUTPUT_EXTENSION "spirv")
         elseif(${TARGET} STREQUAL "ptx")
             set(OUTPUT_EXTENSION "ptx")
+        elseif(${TARGET} STREQUAL "shader-sharedlib")
+            # Host shared object loaded by the CPU backend: conv2d-host.so
+            string(SUBSTRING ${CMAKE_SHARED_LIBRARY_SUFFIX} 1 -1 OUTPUT_EXTENSION)
         else()
             set(OUTPUT_EXTENSION ${TARGET})
         endif()
@@ -42,10 +61,18 @@ function(compile_slang_kernel KERNEL_NAME KERNEL_SOURCE_DIR)
         set(METADATA_PATH ${KERNEL_OUTPUT_DIR}/${KERNEL_NAME}-${PROFILE}.json)
         
         # Build slangc command  
-        # Use -profile for Vulkan/DirectX, -capability for CUDA
-        # Backend-specific entry points: CUDA uses computeMain, others use main
+        # Use -profile for Vulkan/DirectX, -capability for CUDA, no profile for host code
+        # Backend-specific entry points: CUDA and CPU use computeMain (main is reserved in C++), others use main
         if(${BACKEND} STREQUAL "cuda")
             set(SLANG_FLAGS -target ${TARGET} -capability ${PROFILE} -stage compute -entry computeMain -D CUDA_BACKEND -o ${OUTPUT_PATH})
+        elseif(${BACKEND} STREQUAL "cpu")
+            set(SLANG_FLAGS -target ${TARGET} -stage compute -entry computeMain -D CPU_BACKEND -O3)
+            if(${PROFILE} STREQUAL "host-avx2")
+                list(APPEND SLANG_FLAGS -Xgenericcpp -march=x86-64-v3)
+            elseif(${PROFILE} STREQUAL "host-avx512")
+                list(APPEND SLANG_FLAGS -Xgenericcpp -march=x86-64-v4)
+            endif()
+            list(APPEND SLANG_FLAGS -o ${OUTPUT_PATH})
         else()
             set(SLANG_FLAGS -target ${TARGET} -profile ${PROFILE} -stage compute -entry main -o ${OUTPUT_PATH})
         endif()
@@ -2,6 +2,7 @@
 #include "../common/logger.hpp"
 #include "cuda_runner.hpp"
 #include "vulkan_runner.hpp"
+#include "cpu_runner.hpp"
 
 #include <algorithm>
 #include <sys/stat.h>
@@ -190,16 +191,12 @@ Result<void> BackendFactory::DetectBackends() {
         KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Backend unavailable: Vulkan - " + info.error_message);
     }
     
-    // CPU backend (placeholder - not yet implemented)
-    BackendInfo cpu_info;
-    cpu_info.type = Backend::CPU;
-    cpu_info.name = "CPU (Software Fallback - PLACEHOLDER)";
-    cpu_info.available = false;  // Changed to false - not actually implemented
-    cpu_info.version = "1.0.0";
-    cpu_info.library_path = "built-in";
-    cpu_info.error_message = "CPU backend not yet implemented (software fallback for future development)";
-    backend_info_[Backend::CPU] = cpu_info;
-    KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Backend placeholder: CPU - not yet implemented");
+    // CPU backend is built in and runs on every host
+    auto cpu_result = DetectCpuBackend();
+    if (cpu_result) {
+        backend_info_[Backend::CPU] = *cpu_result;
+        LOG_BACKEND_INFO("Detected backend: CPU");
+    }
     
     return KERNTOPIA_VOID_SUCCESS();
 }
@@ -579,9 +576,88 @@ Result<std::shared_ptr<IKernelRunnerFactory>> BackendFactory::CreateVulkanFactor
     return KERNTOPIA_SUCCESS(std::static_pointer_cast<IKernelRunnerFactory>(factory));
 }
 
+/**
+ * @brief CPU backend as exposed by the factory: native devices, then software Vulkan devices
+ * 
+ * Software Vulkan implementations (VK_PHYSICAL_DEVICE_TYPE_CPU, e.g. lavapipe or SwiftShader) get a
+ * Vulkan runner, so hosts without a GPU can exercise the full Vulkan path with --backend cpu --device N.
+ * Kept here so the native CPU runner does not depend on the Vulkan backend.
+ */
+class CpuBackendFactory : public CpuKernelRunnerFactory {
+public:
+    std::vector<DeviceInfo> EnumerateDevices() const override {
+        std::vector<DeviceInfo> devices = CpuKernelRunnerFactory::EnumerateDevices();
+        for (const DeviceInfo& vulkan_device : QuerySoftwareVulkanDevices()) {
+            KERNTOPIA_LOG_INFO(LogComponent::BACKEND, "CPU Device " + std::to_string(devices.size()) + ": " +
+                               vulkan_device.name + " (Vulkan " + vulkan_device.api_version + ", " +
+                               std::to_string(vulkan_device.multiprocessor_count) + " threads)");
+            devices.push_back(vulkan_device);
+        }
+        return devices;
+    }
+    
+    Result<std::unique_ptr<IKernelRunner>> CreateRunner(int device_id = 0) const override {
+        const int native_count = static_cast<int>(CpuKernelRunnerFactory::EnumerateDevices().size());
+        if (device_id < native_count) {
+            return CpuKernelRunnerFactory::CreateRunner(device_id);
+        }
+        
+        // Software Vulkan device: hand it to the Vulkan factory under its index among the Vulkan devices
+        std::vector<DeviceInfo> software_devices = QuerySoftwareVulkanDevices();
+        size_t software_index = static_cast<size_t>(device_id - native_count);
+        if (software_index >= software_devices.size()) {
+            return KERNTOPIA_RESULT_ERROR(std::unique_ptr<IKernelRunner>, ErrorCategory::VALIDATION,
+                                         ErrorCode::INVALID_ARGUMENT,
+                                         "Invalid CPU device ID: " + std::to_string(device_id) + " (available: 0-" +
+                                         std::to_string(native_count + software_devices.size() - 1) + ")");
+        }
+        
+        const DeviceInfo& device = software_devices[software_index];
+        auto system_info = SystemInterrogator::GetSystemInfo();
+        if (system_info) {
+            const std::vector<DeviceInfo>& all_vulkan = system_info->vulkan_runtime.devices;
+            for (size_t i = 0; i < all_vulkan.size(); ++i) {
+                if (all_vulkan[i].device_id == device.device_id) {
+                    KERNTOPIA_LOG_INFO(LogComponent::BACKEND, "CPU device " + std::to_string(device_id) + " runs on Vulkan device " +
+                                       std::to_string(i) + " (" + device.name + ", " +
+                                       std::to_string(device.multiprocessor_count) + " threads)");
+                    return VulkanKernelRunnerFactory().CreateRunner(static_cast<int>(i));
+                }
+            }
+        }
+        return KERNTOPIA_RESULT_ERROR(std::unique_ptr<IKernelRunner>, ErrorCategory::BACKEND,
+                                     ErrorCode::BACKEND_NOT_AVAILABLE, "Vulkan device for CPU device " +
+                                     std::to_string(device_id) + " is no longer available");
+    }
+
+private:
+    static std::vector<DeviceInfo> QuerySoftwareVulkanDevices() {
+        std::vector<DeviceInfo> devices;
+        if (!SystemInterrogator::IsRuntimeAvailable(RuntimeType::VULKAN)) {
+            return devices;
+        }
+        auto system_info = SystemInterrogator::GetSystemInfo();
+        if (!system_info) {
+            return devices;
+        }
+        for (const DeviceInfo& device : system_info->vulkan_runtime.devices) {
+            if (device.backend_type == Backend::CPU) {
+                devices.push_back(device);
+            }
+        }
+        return devices;
+    }
+};
+
 Result<std::shared_ptr<IKernelRunnerFactory>> BackendFactory::CreateCpuFactory() {
-    return KERNTOPIA_RESULT_ERROR(std::shared_ptr<IKernelRunnerFactory>, ErrorCategory::BACKEND,
-                                 ErrorCode::BACKEND_NOT_AVAILABLE, "CPU factory not implemented yet");
+    auto factory = std::make_shared<CpuBackendFactory>();
+    if (!factory->IsAvailable()) {
+        return KERNTOPIA_RESULT_ERROR(std::shared_ptr<IKernelRunnerFactory>, ErrorCategory::BACKEND,
+                                     ErrorCode::BACKEND_NOT_AVAILABLE, "CPU backend not available on this system");
+    }
+    
+    LOG_BACKEND_INFO("Created CPU backend factory");
+    return KERNTOPIA_SUCCESS(std::static_pointer_cast<IKernelRunnerFactory>(factory));
 }
 
 // Backend utility functions
@@ -0,0 +1,159 @@
+#include "cpu_memory.hpp"
+#include "../common/logger.hpp"
+#include "../common/error_handling.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace kerntopia {
+
+// Cache-line alignment keeps worker threads writing neighbouring tiles off each other's lines
+static constexpr size_t kCpuAllocationAlignment = 64;
+
+static void* AllocateHostMemory(size_t size) {
+    return ::operator new(std::max<size_t>(size, 1), std::align_val_t(kCpuAllocationAlignment), std::nothrow);
+}
+
+static void FreeHostMemory(void* data) {
+    ::operator delete(data, std::align_val_t(kCpuAllocationAlignment));
+}
+
+// CpuBuffer implementation
+CpuBuffer::CpuBuffer(size_t size, Type type, Usage usage)
+    : size_(size), type_(type), usage_(usage) {
+    data_ = AllocateHostMemory(size);
+    if (!data_) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "Failed to allocate CPU buffer of " + std::to_string(size) + " bytes");
+    }
+}
+
+CpuBuffer::CpuBuffer(void* host_pointer, size_t size, Type type)
+    : size_(size), type_(type), usage_(Usage::DYNAMIC), data_(host_pointer), owns_data_(false) {
+}
+
+CpuBuffer::~CpuBuffer() {
+    if (data_ && owns_data_) {
+        FreeHostMemory(data_);
+    }
+}
+
+Result<void> CpuBuffer::UploadData(const void* data, size_t size, size_t offset) {
+    if (!data_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                     "CPU buffer not allocated");
+    }
+
+    if (offset + size > size_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Upload size exceeds buffer bounds");
+    }
+
+    // Wrapped host memory uploaded from itself is already in place
+    if (static_cast<uint8_t*>(data_) + offset != data) {
+        std::memcpy(static_cast<uint8_t*>(data_) + offset, data, size);
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuBuffer::DownloadData(void* data, size_t size, size_t offset) {
+    if (!data_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                     "CPU buffer not allocated");
+    }
+
+    if (offset + size > size_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Download size exceeds buffer bounds");
+    }
+
+    if (static_cast<const uint8_t*>(data_) + offset != data) {
+        std::memcpy(data, static_cast<const uint8_t*>(data_) + offset, size);
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+// CpuTexture implementation (simplified as buffer for compute)
+CpuTexture::CpuTexture(const TextureDesc& desc) : desc_(desc) {
+    size_t bytes_per_pixel = 4;
+    switch (desc.format) {
+        case TextureDesc::Format::R8_UNORM: bytes_per_pixel = 1; break;
+        case TextureDesc::Format::RG8_UNORM: bytes_per_pixel = 2; break;
+        case TextureDesc::Format::RGBA8_UNORM: bytes_per_pixel = 4; break;
+        case TextureDesc::Format::R16_FLOAT: bytes_per_pixel = 2; break;
+        case TextureDesc::Format::RGBA16_FLOAT: bytes_per_pixel = 8; break;
+        case TextureDesc::Format::R32_FLOAT: bytes_per_pixel = 4; break;
+        case TextureDesc::Format::RGBA32_FLOAT: bytes_per_pixel = 16; break;
+    }
+
+    size_ = static_cast<size_t>(desc.width) * desc.height * desc.depth * bytes_per_pixel;
+    data_ = AllocateHostMemory(size_);
+    if (!data_) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "Failed to allocate CPU texture of " + std::to_string(size_) + " bytes");
+    }
+}
+
+CpuTexture::~CpuTexture() {
+    if (data_) {
+        FreeHostMemory(data_);
+    }
+}
+
+// Only the base mip level and array layer are stored, so any other subresource does not exist
+static Result<void> CheckBaseSubresource(uint32_t mip_level, uint32_t array_layer) {
+    if (mip_level != 0) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Mip level " + std::to_string(mip_level) + " out of range (CPU textures store 1 level)");
+    }
+    if (array_layer != 0) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Array layer " + std::to_string(array_layer) + " out of range (CPU textures store 1 layer)");
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuTexture::UploadData(const void* data, uint32_t mip_level, uint32_t array_layer) {
+    if (!data) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Null texture upload data");
+    }
+    if (!data_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                     "CPU texture not allocated");
+    }
+
+    auto subresource_result = CheckBaseSubresource(mip_level, array_layer);
+    if (!subresource_result) {
+        return subresource_result;
+    }
+
+    std::memcpy(data_, data, size_);
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuTexture::DownloadData(void* data, size_t data_size, uint32_t mip_level, uint32_t array_layer) {
+    if (!data) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Null texture download destination");
+    }
+    if (!data_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                     "CPU texture not allocated");
+    }
+
+    auto subresource_result = CheckBaseSubresource(mip_level, array_layer);
+    if (!subresource_result) {
+        return subresource_result;
+    }
+
+    if (data_size < size_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Texture download needs " + std::to_string(size_) + " bytes, got " +
+                                     std::to_string(data_size));
+    }
+
+    std::memcpy(data, data_, size_);
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+} // namespace kerntopia
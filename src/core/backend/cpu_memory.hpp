@@ -0,0 +1,66 @@
+#pragma once
+
+#include "ikernel_runner.hpp"
+#include <memory>
+
+namespace kerntopia {
+
+/**
+ * @brief CPU buffer implementation backed by host memory
+ *
+ * Kernels compiled for the host read and write the allocation directly, so the
+ * device address is the host pointer and uploads/downloads are plain copies. A buffer
+ * may also alias caller-owned memory (WrapHostMemory), in which case transfers from
+ * that same memory are skipped.
+ */
+class CpuBuffer : public IBuffer {
+public:
+    CpuBuffer(size_t size, Type type, Usage usage);
+    CpuBuffer(void* host_pointer, size_t size, Type type);    ///< Aliases caller-owned memory
+    ~CpuBuffer();
+
+    size_t GetSize() const override { return size_; }
+    Type GetType() const override { return type_; }
+
+    void* Map() override { return data_; }
+    void Unmap() override {}
+
+    Result<void> UploadData(const void* data, size_t size, size_t offset = 0) override;
+    Result<void> DownloadData(void* data, size_t size, size_t offset = 0) override;
+    uint64_t GetDeviceAddress() const override { return reinterpret_cast<uintptr_t>(data_); }
+
+    // CPU-specific methods
+    void* GetData() const { return data_; }
+
+private:
+    size_t size_;
+    Type type_;
+    Usage usage_;
+    void* data_ = nullptr;
+    bool owns_data_ = true;
+};
+
+/**
+ * @brief CPU texture implementation (simplified as a linear buffer for compute)
+ */
+class CpuTexture : public ITexture {
+public:
+    CpuTexture(const TextureDesc& desc);
+    ~CpuTexture();
+
+    const TextureDesc& GetDesc() const override { return desc_; }
+
+    Result<void> UploadData(const void* data, uint32_t mip_level = 0, uint32_t array_layer = 0) override;
+    Result<void> DownloadData(void* data, size_t data_size, uint32_t mip_level = 0, uint32_t array_layer = 0) override;
+
+    // CPU-specific methods
+    void* GetData() const { return data_; }
+    size_t GetSize() const { return size_; }
+
+private:
+    TextureDesc desc_;
+    size_t size_ = 0;
+    void* data_ = nullptr;
+};
+
+} // namespace kerntopia
@@ -0,0 +1,1110 @@
+#include "cpu_runner.hpp"
+#include "../common/logger.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace kerntopia {
+
+// Identifies the native devices among those the factory lists
+static const char* const kNativeApiVersion = "Slang shader-sharedlib";
+
+// Allocations smaller than a page per worker are not worth spreading across nodes
+static constexpr size_t kFirstTouchPageBytes = 4096;
+
+/**
+ * @brief NUMA node of the host with the CPUs this process may run on
+ */
+struct HostNumaNode {
+    uint32_t id = 0;
+    std::vector<uint32_t> cpus;
+    uint64_t total_memory_bytes = 0;
+    uint64_t free_memory_bytes = 0;
+};
+
+/**
+ * @brief Parse a sysfs CPU list such as "0-15,32-47"
+ */
+static std::vector<uint32_t> ParseCpuList(const std::string& list) {
+    std::vector<uint32_t> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || !std::isdigit(static_cast<unsigned char>(range[0]))) {
+            continue;
+        }
+        size_t dash = range.find('-');
+        uint32_t first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+        uint32_t last = dash == std::string::npos ? first : static_cast<uint32_t>(std::stoul(range.substr(dash + 1)));
+        for (uint32_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @brief Read the NUMA topology from /sys/devices/system/node
+ *
+ * CPUs outside the process affinity mask (cgroup or taskset limits) are dropped, as are nodes
+ * left without CPUs such as memory-only nodes. Returns an empty list where sysfs has no topology.
+ */
+static std::vector<HostNumaNode> QueryNumaNodes() {
+    std::vector<HostNumaNode> nodes;
+#ifdef __linux__
+    cpu_set_t allowed;
+    bool have_mask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/node", error)) {
+        std::string name = entry.path().filename().string();
+        if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+            name.find_first_not_of("0123456789", 4) != std::string::npos) {
+            continue;
+        }
+
+        HostNumaNode node;
+        node.id = static_cast<uint32_t>(std::stoul(name.substr(4)));
+        std::ifstream cpulist(entry.path() / "cpulist");
+        std::string list;
+        std::getline(cpulist, list);
+        for (uint32_t cpu : ParseCpuList(list)) {
+            if (!have_mask || (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))) {
+                node.cpus.push_back(cpu);
+            }
+        }
+        if (node.cpus.empty()) {
+            continue;
+        }
+
+        // Lines read "Node 0 MemTotal:       65843328 kB"
+        std::ifstream meminfo(entry.path() / "meminfo");
+        std::string line;
+        while (std::getline(meminfo, line)) {
+            std::istringstream fields(line);
+            std::string node_label, node_id, key;
+            uint64_t kilobytes = 0;
+            if (fields >> node_label >> node_id >> key >> kilobytes) {
+                if (key == "MemTotal:") {
+                    node.total_memory_bytes = kilobytes * 1024;
+                } else if (key == "MemFree:") {
+                    node.free_memory_bytes = kilobytes * 1024;
+                }
+            }
+        }
+        nodes.push_back(std::move(node));
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const HostNumaNode& a, const HostNumaNode& b) { return a.id < b.id; });
+#endif
+    return nodes;
+}
+
+/**
+ * @brief Restrict the calling thread to one CPU
+ */
+static bool PinThreadToCpu(int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+uint32_t ParseWorkerThreadCount(const char* value, uint32_t fallback) {
+    if (!value || !*value) {
+        return fallback;
+    }
+
+    // strtoul skips whitespace and negates a leading '-', so "-1" would wrap to ULONG_MAX
+    if (!std::isdigit(static_cast<unsigned char>(value[0]))) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Ignoring invalid KERNTOPIA_CPU_THREADS value: " + std::string(value));
+        return fallback;
+    }
+    errno = 0;
+    char* end = nullptr;
+    unsigned long requested = std::strtoul(value, &end, 10);
+    if (*end != '\0' || requested == 0) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Ignoring invalid KERNTOPIA_CPU_THREADS value: " + std::string(value));
+        return fallback;
+    }
+    if (errno == ERANGE || requested > kMaxCpuWorkerThreads) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Clamping KERNTOPIA_CPU_THREADS=" + std::string(value) +
+                              " to " + std::to_string(kMaxCpuWorkerThreads) + " threads");
+        return kMaxCpuWorkerThreads;
+    }
+    return static_cast<uint32_t>(requested);
+}
+
+/**
+ * @brief Worker thread count: KERNTOPIA_CPU_THREADS if set, otherwise the hardware concurrency
+ */
+static uint32_t QueryWorkerThreadCount() {
+    return ParseWorkerThreadCount(std::getenv("KERNTOPIA_CPU_THREADS"), std::max(1u, std::thread::hardware_concurrency()));
+}
+
+/**
+ * @brief Build a unique temporary path for a kernel shared object
+ *
+ * The runtime loader caches libraries by path, so every load needs its own file.
+ */
+static std::string MakeKernelLibraryPath() {
+    static std::atomic<uint32_t> library_counter{0};
+
+    std::error_code error;
+    std::filesystem::path temp_dir = std::filesystem::temp_directory_path(error);
+    if (error) {
+        return "";
+    }
+
+#ifdef _WIN32
+    unsigned long process_id = GetCurrentProcessId();
+#else
+    unsigned long process_id = static_cast<unsigned long>(getpid());
+#endif
+    std::string filename = "kerntopia_cpu_kernel_" + std::to_string(process_id) + "_" +
+                           std::to_string(library_counter++) + RuntimeLoader::GetLibraryExtension();
+    return (temp_dir / filename).string();
+}
+
+/**
+ * @brief Interleave the bits of x and y into a Morton (Z-order) code
+ * 
+ * Both coordinates keep all 32 bits, so every grid the dispatch limits allow gets distinct codes.
+ */
+static uint64_t MortonEncode(uint32_t x, uint32_t y) {
+    auto spread = [](uint64_t v) {
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        v = (v | (v << 2)) & 0x3333333333333333ull;
+        v = (v | (v << 1)) & 0x5555555555555555ull;
+        return v;
+    };
+    return spread(x) | (spread(y) << 1);
+}
+
+static uint64_t PackRange(uint32_t begin, uint32_t end) {
+    return (static_cast<uint64_t>(begin) << 32) | end;
+}
+
+/**
+ * @brief Detect the SIMD instruction sets kernels may use on this host, widest first
+ *
+ * The names match the ISA suffix of the kernel variants the build produces
+ * (conv2d-host-avx2.so is compiled for x86-64-v3, conv2d-host-avx512.so for x86-64-v4).
+ * The runtime checks include OS support for the wider register state.
+ */
+static std::vector<std::string> DetectSimdIsas() {
+    std::vector<std::string> isas;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl") &&
+        __builtin_cpu_supports("avx512cd")) {
+        isas.push_back("avx512");
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("bmi2")) {
+        isas.push_back("avx2");
+    }
+    isas.push_back("sse2");
+#elif defined(_M_X64) || defined(_M_IX86)
+    isas.push_back("sse2");
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    isas.push_back("neon");
+#else
+    isas.push_back("scalar");
+#endif
+    return isas;
+}
+
+// CpuKernelRunner implementation
+CpuKernelRunner::CpuKernelRunner(int device_id, const DeviceInfo& device_info)
+    : device_id_(device_id), device_info_(device_info) {
+    StartWorkers();
+}
+
+CpuKernelRunner::~CpuKernelRunner() {
+    StopWorkers();
+    list_recording_ = false;
+    UnloadKernel();
+    for (const auto& [library, path] : retired_libraries_) {
+        ReleaseLibrary(library, path);
+    }
+}
+
+void CpuKernelRunner::StartWorkers() {
+    // The dispatching thread runs groups too, so it counts as one of the workers
+    thread_count_ = std::max(1u, device_info_.multiprocessor_count);
+    worker_states_.reset(new CpuWorkerState[thread_count_]);
+    AssignWorkerCpus();
+    for (uint32_t i = 1; i < thread_count_; ++i) {
+        workers_.emplace_back(&CpuKernelRunner::WorkerLoop, this, i);
+    }
+
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Started CPU worker pool with " + std::to_string(thread_count_) + " threads" +
+                        (pin_workers_ ? " pinned across " + std::to_string(device_info_.numa_nodes.size()) + " NUMA nodes" : ""));
+}
+
+void CpuKernelRunner::AssignWorkerCpus() {
+    worker_cpus_.assign(thread_count_, -1);
+    worker_nodes_.assign(thread_count_, 0);
+
+    std::vector<std::pair<int, uint32_t>> cpus;  // (cpu, node) in node order
+    for (size_t n = 0; n < device_info_.numa_nodes.size() && n < device_info_.numa_node_cpus.size(); ++n) {
+        for (uint32_t cpu : device_info_.numa_node_cpus[n]) {
+            cpus.emplace_back(static_cast<int>(cpu), device_info_.numa_nodes[n]);
+        }
+    }
+    if (cpus.empty()) {
+        return;
+    }
+
+    // Evenly spaced picks from the node-ordered list keep each node's workers on adjacent indices
+    for (uint32_t i = 0; i < thread_count_; ++i) {
+        const auto& [cpu, node] = cpus[static_cast<size_t>(i) * cpus.size() / thread_count_];
+        worker_cpus_[i] = cpu;
+        worker_nodes_[i] = node;
+    }
+
+    // Placement only matters when memory differs between nodes or the device is held to one of them
+    pin_workers_ = device_info_.numa_nodes.size() > 1 || device_info_.numa_node >= 0;
+}
+
+void CpuKernelRunner::StopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        pool_stop_ = true;
+    }
+    pool_wake_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+}
+
+void CpuKernelRunner::WorkerLoop(uint32_t worker_index) {
+    if (pin_workers_ && !PinThreadToCpu(worker_cpus_[worker_index])) {
+        KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Could not pin CPU worker " + std::to_string(worker_index) +
+                            " to CPU " + std::to_string(worker_cpus_[worker_index]));
+    }
+
+    uint64_t seen_generation = 0;
+    std::unique_lock<std::mutex> lock(pool_mutex_);
+    for (;;) {
+        pool_wake_.wait(lock, [&] { return pool_stop_ || job_generation_ != seen_generation; });
+        if (pool_stop_) {
+            return;
+        }
+        seen_generation = job_generation_;
+        const std::function<void(uint32_t)>* job = job_;
+        lock.unlock();
+
+        (*job)(worker_index);
+
+        lock.lock();
+        if (--active_workers_ == 0) {
+            pool_done_.notify_one();
+        }
+    }
+}
+
+void CpuKernelRunner::RunGroups(uint32_t worker_index, const CpuDispatch& dispatch) {
+    auto start = std::chrono::high_resolution_clock::now();
+    void* entry_point_params = dispatch.entry_point_params.empty() ? nullptr :
+                               const_cast<uint8_t*>(dispatch.entry_point_params.data());
+    void* global_params = dispatch.global_params.empty() ? nullptr :
+                          const_cast<uint8_t*>(dispatch.global_params.data());
+    const uint32_t groups_xy = dispatch.groups[0] * dispatch.groups[1];
+    CpuWorkerState& state = worker_states_[worker_index];
+
+    for (;;) {
+        // Take tiles from the front of the own slice; thieves may shrink it from the back meanwhile
+        uint64_t range = state.range.load(std::memory_order_acquire);
+        uint32_t begin = static_cast<uint32_t>(range >> 32);
+        uint32_t end = static_cast<uint32_t>(range);
+        if (begin >= end) {
+            if (!StealTiles(worker_index)) {
+                break;
+            }
+            continue;
+        }
+        if (!state.range.compare_exchange_weak(range, PackRange(begin + 1, end), std::memory_order_acq_rel)) {
+            continue;
+        }
+
+        uint32_t index = tile_order_[begin];
+        CpuVaryingInput input;
+        input.start_group_id[0] = index % dispatch.groups[0];
+        input.start_group_id[1] = (index / dispatch.groups[0]) % dispatch.groups[1];
+        input.start_group_id[2] = index / groups_xy;
+        for (int d = 0; d < 3; ++d) {
+            input.end_group_id[d] = input.start_group_id[d] + 1;
+        }
+        dispatch.function(&input, entry_point_params, global_params);
+        ++state.groups;
+    }
+
+    state.busy_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+bool CpuKernelRunner::StealTiles(uint32_t thief_index) {
+    CpuWorkerState& thief = worker_states_[thief_index];
+    for (;;) {
+        // The fullest slice is the one least likely to run dry before the steal pays off. Slices on the
+        // thief's own node come first since their pages are local; another node's only once those are empty
+        uint32_t victim_index = thief_index;
+        uint32_t most_remaining = 0;
+        for (int pass = 0; pass < 2 && victim_index == thief_index; ++pass) {
+            for (uint32_t i = 0; i < thread_count_; ++i) {
+                if (pass == 0 && worker_nodes_[i] != worker_nodes_[thief_index]) {
+                    continue;
+                }
+                uint64_t range = worker_states_[i].range.load(std::memory_order_relaxed);
+                uint32_t begin = static_cast<uint32_t>(range >> 32);
+                uint32_t end = static_cast<uint32_t>(range);
+                if (i != thief_index && end > begin && end - begin > most_remaining) {
+                    most_remaining = end - begin;
+                    victim_index = i;
+                }
+            }
+        }
+        if (victim_index == thief_index) {
+            return false;
+        }
+
+        // Split off the back half, which lies furthest from where the victim is working
+        CpuWorkerState& victim = worker_states_[victim_index];
+        uint64_t range = victim.range.load(std::memory_order_acquire);
+        uint32_t begin = static_cast<uint32_t>(range >> 32);
+        uint32_t end = static_cast<uint32_t>(range);
+        if (begin >= end) {
+            continue;
+        }
+        uint32_t split = end - (end - begin + 1) / 2;
+        if (victim.range.compare_exchange_strong(range, PackRange(begin, split), std::memory_order_acq_rel)) {
+            thief.range.store(PackRange(split, end), std::memory_order_release);
+            ++thief.steals;
+            thief.stolen_groups += end - split;
+            if (worker_nodes_[victim_index] != worker_nodes_[thief_index]) {
+                ++thief.remote_steals;
+            }
+            return true;
+        }
+    }
+}
+
+std::vector<uint32_t> BuildMortonTileOrder(const uint32_t groups[3]) {
+    // Walk each z slice along a Z-order curve so consecutive tiles are 2D neighbours; a 1D grid keeps its order
+    const uint32_t groups_xy = groups[0] * groups[1];
+    std::vector<std::pair<uint64_t, uint32_t>> keyed;
+    keyed.reserve(static_cast<size_t>(groups_xy) * groups[2]);
+    for (uint32_t z = 0; z < groups[2]; ++z) {
+        for (uint32_t y = 0; y < groups[1]; ++y) {
+            for (uint32_t x = 0; x < groups[0]; ++x) {
+                keyed.emplace_back(MortonEncode(x, y), z * groups_xy + y * groups[0] + x);
+            }
+        }
+        // Slices stay in z order; only the tiles within one are reordered
+        if (groups[1] > 1) {
+            std::sort(keyed.end() - groups_xy, keyed.end());
+        }
+    }
+
+    std::vector<uint32_t> order(keyed.size());
+    for (size_t i = 0; i < keyed.size(); ++i) {
+        order[i] = keyed[i].second;
+    }
+    return order;
+}
+
+void CpuKernelRunner::BuildTileOrder(const uint32_t groups[3]) {
+    if (std::equal(groups, groups + 3, tile_order_groups_) && !tile_order_.empty()) {
+        return;
+    }
+    tile_order_ = BuildMortonTileOrder(groups);
+    std::copy(groups, groups + 3, tile_order_groups_);
+}
+
+float CpuKernelRunner::ExecuteDispatch(const CpuDispatch& dispatch) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    uint64_t group_count = static_cast<uint64_t>(dispatch.groups[0]) * dispatch.groups[1] * dispatch.groups[2];
+    for (uint32_t i = 0; i < thread_count_; ++i) {
+        CpuWorkerState& state = worker_states_[i];
+        state.range.store(0, std::memory_order_relaxed);
+        state.groups = 0;
+        state.steals = 0;
+        state.stolen_groups = 0;
+        state.remote_steals = 0;
+        state.busy_ms = 0.0f;
+    }
+
+    if (group_count > 0) {
+        // Each thread starts on a contiguous slice of the Morton order
+        BuildTileOrder(dispatch.groups);
+        for (uint32_t i = 0; i < thread_count_; ++i) {
+            uint32_t begin = static_cast<uint32_t>(group_count * i / thread_count_);
+            uint32_t end = static_cast<uint32_t>(group_count * (i + 1) / thread_count_);
+            worker_states_[i].range.store(PackRange(begin, end), std::memory_order_relaxed);
+        }
+
+        std::function<void(uint32_t)> run_groups = [this, &dispatch](uint32_t worker_index) {
+            RunGroups(worker_index, dispatch);
+        };
+        RunOnPool(run_groups);
+    }
+
+    float elapsed_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+    // Scheduler counters stand in for device counters on this backend
+    last_timing_.counters.clear();
+    if (collect_counters_) {
+        uint64_t steals = 0;
+        uint64_t stolen_groups = 0;
+        uint64_t remote_steals = 0;
+        for (uint32_t i = 0; i < thread_count_; ++i) {
+            const CpuWorkerState& state = worker_states_[i];
+            steals += state.steals;
+            stolen_groups += state.stolen_groups;
+            remote_steals += state.remote_steals;
+            last_timing_.counters["thread_" + std::to_string(i) + "_busy_ms"] = state.busy_ms;
+            last_timing_.counters["thread_" + std::to_string(i) + "_groups"] = static_cast<double>(state.groups);
+        }
+        last_timing_.counters["steals"] = static_cast<double>(steals);
+        last_timing_.counters["stolen_groups"] = static_cast<double>(stolen_groups);
+        last_timing_.counters["remote_steals"] = static_cast<double>(remote_steals);
+        last_timing_.counters["dispatched_invocations"] =
+            static_cast<double>(group_count) * group_size_[0] * group_size_[1] * group_size_[2];
+    }
+
+    return elapsed_ms;
+}
+
+void CpuKernelRunner::RunOnPool(const std::function<void(uint32_t)>& job) {
+#ifdef __linux__
+    // The dispatching thread is worker 0: hold it on its CPU for the job and give the caller its mask back after
+    cpu_set_t caller_mask;
+    bool restore_mask = pin_workers_ && pthread_getaffinity_np(pthread_self(), sizeof(caller_mask), &caller_mask) == 0 &&
+                        PinThreadToCpu(worker_cpus_[0]);
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        job_ = &job;
+        active_workers_ = static_cast<uint32_t>(workers_.size());
+        ++job_generation_;
+    }
+    pool_wake_.notify_all();
+
+    job(0);
+
+    {
+        std::unique_lock<std::mutex> lock(pool_mutex_);
+        pool_done_.wait(lock, [this] { return active_workers_ == 0; });
+        job_ = nullptr;
+    }
+
+#ifdef __linux__
+    if (restore_mask) {
+        pthread_setaffinity_np(pthread_self(), sizeof(caller_mask), &caller_mask);
+    }
+#endif
+}
+
+void CpuKernelRunner::FirstTouch(void* data, size_t size) {
+    // Pages land on the node of the thread that first writes them; zeroing in the same per-worker bands
+    // the tile order starts out in puts each band on the node that will sweep it
+    if (!pin_workers_ || size < kFirstTouchPageBytes * thread_count_) {
+        return;
+    }
+    uint8_t* bytes = static_cast<uint8_t*>(data);
+    std::function<void(uint32_t)> touch = [this, bytes, size](uint32_t worker_index) {
+        size_t begin = size * worker_index / thread_count_;
+        size_t end = size * (worker_index + 1) / thread_count_;
+        std::memset(bytes + begin, 0, end - begin);
+    };
+    RunOnPool(touch);
+}
+
+CpuKernelRunner::CpuDispatch CpuKernelRunner::CaptureDispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) const {
+    CpuDispatch dispatch;
+    dispatch.function = function_;
+    dispatch.groups[0] = groups_x;
+    dispatch.groups[1] = groups_y;
+    dispatch.groups[2] = groups_z;
+    dispatch.entry_point_params = entry_point_params_;
+    dispatch.global_params = global_params_;
+    return dispatch;
+}
+
+void CpuKernelRunner::ReleaseLibrary(LibraryHandle library, const std::string& path) {
+    auto unload_result = RuntimeLoader::GetInstance().UnloadLibrary(library);
+    if (!unload_result) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Failed to unload CPU kernel library: " + unload_result.GetError().message);
+    }
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+}
+
+void CpuKernelRunner::UnloadKernel() {
+    if (!library_) {
+        return;
+    }
+
+    // Dispatches already captured in an open command list still call into the old library
+    if (list_recording_) {
+        retired_libraries_.emplace_back(library_, library_path_);
+    } else {
+        ReleaseLibrary(library_, library_path_);
+    }
+
+    library_ = nullptr;
+    library_path_.clear();
+    function_ = nullptr;
+    entry_point_.clear();
+}
+
+Result<void> CpuKernelRunner::LoadKernel(const std::vector<uint8_t>& bytecode, const std::string& entry_point) {
+    if (bytecode.empty()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Kernel library is empty");
+    }
+    has_recording_ = false;
+
+    auto load_start = std::chrono::high_resolution_clock::now();
+
+    // The loader needs the shared object on disk
+    std::string path = MakeKernelLibraryPath();
+    if (path.empty()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     "No temporary directory for the CPU kernel library");
+    }
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bytecode.data()), static_cast<std::streamsize>(bytecode.size()));
+        if (!file) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         "Failed to write CPU kernel library: " + path);
+        }
+    }
+
+    RuntimeLoader& loader = RuntimeLoader::GetInstance();
+    auto library_result = loader.LoadLibrary(path);
+    if (!library_result) {
+        std::error_code error;
+        std::filesystem::remove(path, error);
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::KERNEL_LOAD_FAILED,
+                                     "Failed to load CPU kernel library: " + library_result.GetError().message);
+    }
+    LibraryHandle library = *library_result;
+
+#ifndef _WIN32
+    // The mapping outlives the file, so nothing is left behind if the process dies
+    std::error_code remove_error;
+    std::filesystem::remove(path, remove_error);
+#endif
+
+    // Prefer the single-group entry; the range entry runs the same group when given a one-group range
+    void* symbol = loader.GetSymbol(library, entry_point + "_Group");
+    if (!symbol) {
+        symbol = loader.GetSymbol(library, entry_point);
+    }
+    if (!symbol) {
+        ReleaseLibrary(library, path);
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::KERNEL_LOAD_FAILED,
+                                     "CPU kernel library has no entry point '" + entry_point + "'");
+    }
+
+    UnloadKernel();
+    library_ = library;
+    library_path_ = path;
+    function_ = reinterpret_cast<CpuKernelFunction>(symbol);
+    entry_point_ = entry_point;
+
+    last_timing_.pipeline_creation_time_ms = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - load_start).count();
+
+    KERNTOPIA_LOG_INFO(LogComponent::BACKEND, "Loaded CPU kernel: " + entry_point + " (" +
+                      std::to_string(bytecode.size()) + " bytes)");
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::SetSpecialization(const KernelSpecialization& specialization) {
+    // Host code is fully compiled: the workgroup loop and constants are baked into the library
+    if (!specialization.constants.empty()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "CPU kernels do not support specialization constants");
+    }
+    for (int d = 0; d < 3; ++d) {
+        if (specialization.local_size[d] != 0 && specialization.local_size[d] != group_size_[d]) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                         "CPU kernels run the workgroup size they were compiled with");
+        }
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::SetParameters(const void* params, size_t size) {
+    has_recording_ = false;
+    entry_point_params_.resize(size);
+    std::memcpy(entry_point_params_.data(), params, size);
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::SetSlangGlobalParameters(const void* params, size_t size) {
+    if (!function_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_NOT_AVAILABLE,
+                                     "No kernel loaded");
+    }
+
+    has_recording_ = false;
+    global_params_.resize(size);
+    std::memcpy(global_params_.data(), params, size);
+
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Set SLANG global parameters: " + std::to_string(size) + " bytes");
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::SetBuffer(int binding, std::shared_ptr<IBuffer> buffer) {
+    auto cpu_buffer = std::dynamic_pointer_cast<CpuBuffer>(buffer);
+    if (!cpu_buffer) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Buffer is not a CPU buffer");
+    }
+
+    buffer_bindings_[binding] = cpu_buffer;
+    has_recording_ = false;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::SetTexture(int binding, std::shared_ptr<ITexture> texture) {
+    auto cpu_texture = std::dynamic_pointer_cast<CpuTexture>(texture);
+    if (!cpu_texture) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Texture is not a CPU texture");
+    }
+
+    texture_bindings_[binding] = cpu_texture;
+    has_recording_ = false;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::Dispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) {
+    if (!function_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_NOT_AVAILABLE,
+                                     "No kernel loaded");
+    }
+
+    if (static_cast<uint64_t>(groups_x) * groups_y * groups_z > UINT32_MAX) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Dispatch exceeds the CPU backend limit of 2^32 groups");
+    }
+
+    // Inside BeginCommandList/SubmitCommandList the dispatch is captured for the list
+    if (list_recording_) {
+        list_dispatches_.push_back(CaptureDispatch(groups_x, groups_y, groups_z));
+        return KERNTOPIA_VOID_SUCCESS();
+    }
+
+    CpuDispatch dispatch = CaptureDispatch(groups_x, groups_y, groups_z);
+    auto start_time = std::chrono::steady_clock::now();
+    float elapsed_ms = ExecuteDispatch(dispatch);
+
+    last_timing_.start_time = start_time;
+    last_timing_.end_time = std::chrono::steady_clock::now();
+    last_timing_.compute_time_ms = elapsed_ms;
+    last_timing_.device_time_ms = elapsed_ms;
+    last_timing_.iteration_times_ms.clear();
+    last_timing_.dispatch_times_ms.clear();
+    ++completion_token_;
+
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Dispatched CPU kernel: " +
+                       std::to_string(groups_x) + "x" + std::to_string(groups_y) + "x" + std::to_string(groups_z));
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::RecordDispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) {
+    if (!function_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_NOT_AVAILABLE,
+                                     "No kernel loaded");
+    }
+
+    if (static_cast<uint64_t>(groups_x) * groups_y * groups_z > UINT32_MAX) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Dispatch exceeds the CPU backend limit of 2^32 groups");
+    }
+
+    recorded_ = CaptureDispatch(groups_x, groups_y, groups_z);
+    has_recording_ = true;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::ReplayRecorded(uint32_t iterations) {
+    if (!has_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "No recorded dispatch to replay (bindings or parameters changed since RecordDispatch?)");
+    }
+    if (iterations == 0) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Replay iteration count cannot be zero");
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    last_timing_.iteration_times_ms.clear();
+    last_timing_.dispatch_times_ms.clear();
+    float sum_ms = 0.0f;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        float elapsed_ms = ExecuteDispatch(recorded_);
+        last_timing_.iteration_times_ms.push_back(elapsed_ms);
+        sum_ms += elapsed_ms;
+    }
+
+    last_timing_.start_time = start_time;
+    last_timing_.end_time = std::chrono::steady_clock::now();
+    last_timing_.device_time_ms = sum_ms / iterations;
+    last_timing_.compute_time_ms = last_timing_.device_time_ms;
+    ++completion_token_;
+
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Replayed CPU kernel " + std::to_string(iterations) + " times");
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::BeginCommandList() {
+    if (list_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "A command list is already being recorded");
+    }
+
+    list_dispatches_.clear();
+    list_recording_ = true;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::RecordBarrier() {
+    if (!list_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "RecordBarrier requires an open command list");
+    }
+
+    // Each dispatch finishes on every worker before the next one starts, so there is nothing to record
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::SubmitCommandList() {
+    if (!list_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "No command list is being recorded");
+    }
+    list_recording_ = false;
+    if (list_dispatches_.empty()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Command list has no dispatches");
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+    last_timing_.iteration_times_ms.clear();
+    last_timing_.dispatch_times_ms.clear();
+    float list_ms = 0.0f;
+    for (const CpuDispatch& dispatch : list_dispatches_) {
+        float elapsed_ms = ExecuteDispatch(dispatch);
+        last_timing_.dispatch_times_ms.push_back(elapsed_ms);
+        list_ms += elapsed_ms;
+    }
+
+    last_timing_.start_time = start_time;
+    last_timing_.end_time = std::chrono::steady_clock::now();
+    last_timing_.device_time_ms = list_ms;
+    last_timing_.compute_time_ms = list_ms;
+    ++completion_token_;
+
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Submitted CPU command list: " + std::to_string(list_dispatches_.size()) + " dispatches");
+
+    // Libraries replaced during recording are no longer referenced
+    list_dispatches_.clear();
+    for (const auto& [library, path] : retired_libraries_) {
+        ReleaseLibrary(library, path);
+    }
+    retired_libraries_.clear();
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::DispatchPipelined(std::shared_ptr<IBuffer> input, const std::vector<const void*>& frames,
+                                                size_t frame_size, uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) {
+    if (!input || frames.empty() || frame_size == 0 || frame_size > input->GetSize()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Pipelined run needs an input buffer and at least one frame that fits it");
+    }
+    if (list_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Pipelined run cannot be recorded into a command list");
+    }
+
+    // Uploads are copies on the dispatching thread, so frames run back to back without overlap
+    float upload_ms = 0.0f;
+    auto run_frame = [&](const void* frame) -> Result<void> {
+        auto upload_start = std::chrono::high_resolution_clock::now();
+        auto upload_result = input->UploadData(frame, frame_size);
+        if (!upload_result) {
+            return upload_result;
+        }
+        upload_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - upload_start).count();
+        return Dispatch(groups_x, groups_y, groups_z);
+    };
+
+    auto reference_start = std::chrono::high_resolution_clock::now();
+    auto frame_result = run_frame(frames[0]);
+    if (!frame_result) {
+        return frame_result;
+    }
+    float reference_upload_ms = upload_ms;
+    float frame_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - reference_start).count();
+
+    auto pipeline_start = std::chrono::high_resolution_clock::now();
+    for (const void* frame : frames) {
+        frame_result = run_frame(frame);
+        if (!frame_result) {
+            return frame_result;
+        }
+    }
+
+    last_timing_.memory_setup_time_ms = reference_upload_ms;
+    last_timing_.compute_time_ms = std::max(0.0f, frame_ms - reference_upload_ms);
+    last_timing_.total_time_ms = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - pipeline_start).count();
+    last_timing_.transfer_overlap = 0.0f;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::SetCounterCollection(bool enable) {
+    collect_counters_ = enable;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<bool> CpuKernelRunner::IsTokenComplete(uint64_t token) {
+    if (token > completion_token_) {
+        return KERNTOPIA_RESULT_ERROR(bool, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Completion token " + std::to_string(token) + " has not been issued");
+    }
+    return Result<bool>::Success(true);
+}
+
+Result<void> CpuKernelRunner::WaitForToken(uint64_t token) {
+    if (token > completion_token_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Completion token " + std::to_string(token) + " has not been issued");
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CpuKernelRunner::WaitForCompletion() {
+    // Work has already run on return from the submitting call; only the host view is left to fill in
+    auto duration = last_timing_.end_time - last_timing_.start_time;
+    last_timing_.total_time_ms = std::chrono::duration<float, std::milli>(duration).count();
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+TimingResults CpuKernelRunner::GetLastExecutionTime() {
+    return last_timing_;
+}
+
+Result<std::shared_ptr<IBuffer>> CpuKernelRunner::CreateBuffer(size_t size, IBuffer::Type type, IBuffer::Usage usage) {
+    auto buffer = std::make_shared<CpuBuffer>(size, type, usage);
+    if (!buffer->GetData()) {
+        return KERNTOPIA_RESULT_ERROR(std::shared_ptr<IBuffer>, ErrorCategory::BACKEND,
+                                     ErrorCode::MEMORY_ALLOCATION_FAILED, "Failed to allocate CPU buffer");
+    }
+    FirstTouch(buffer->GetData(), size);
+
+    return Result<std::shared_ptr<IBuffer>>::Success(buffer);
+}
+
+Result<std::shared_ptr<ITexture>> CpuKernelRunner::CreateTexture(const TextureDesc& desc) {
+    auto texture = std::make_shared<CpuTexture>(desc);
+    if (!texture->GetData()) {
+        return KERNTOPIA_RESULT_ERROR(std::shared_ptr<ITexture>, ErrorCategory::BACKEND,
+                                     ErrorCode::MEMORY_ALLOCATION_FAILED, "Failed to allocate CPU texture");
+    }
+    FirstTouch(texture->GetData(), texture->GetSize());
+
+    return Result<std::shared_ptr<ITexture>>::Success(texture);
+}
+
+Result<std::shared_ptr<IBuffer>> CpuKernelRunner::WrapHostMemory(void* host_pointer, size_t size, IBuffer::Type type) {
+    if (!host_pointer || size == 0) {
+        return KERNTOPIA_RESULT_ERROR(std::shared_ptr<IBuffer>, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Host memory to wrap must be non-null and non-empty");
+    }
+
+    // Kernels run on the host, so the buffer is the caller's memory; its pages stay where the caller put them
+    std::shared_ptr<IBuffer> buffer = std::make_shared<CpuBuffer>(host_pointer, size, type);
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Wrapped " + std::to_string(size) + " bytes of host memory");
+    return Result<std::shared_ptr<IBuffer>>::Success(buffer);
+}
+
+void CpuKernelRunner::CalculateDispatchSize(uint32_t width, uint32_t height, uint32_t depth,
+                                           uint32_t& groups_x, uint32_t& groups_y, uint32_t& groups_z) {
+    groups_x = (width + group_size_[0] - 1) / group_size_[0];
+    groups_y = (height + group_size_[1] - 1) / group_size_[1];
+    groups_z = (std::max(1u, depth) + group_size_[2] - 1) / group_size_[2];
+}
+
+std::string CpuKernelRunner::GetDebugInfo() const {
+    std::ostringstream info;
+    info << "CPU Kernel Runner:\n";
+    info << "  Device ID: " << device_id_ << "\n";
+    info << "  Device Name: " << GetDeviceName() << "\n";
+    info << "  Worker Threads: " << thread_count_ << " (work stealing, Morton-ordered tiles)\n";
+    info << "  SIMD ISA: " << device_info_.compute_capability << " (supported:";
+    for (const std::string& isa : device_info_.supported_extensions) {
+        info << " " << isa;
+    }
+    info << ")\n";
+    if (!device_info_.numa_nodes.empty()) {
+        info << "  NUMA Nodes:";
+        for (uint32_t node : device_info_.numa_nodes) {
+            info << " " << node;
+        }
+        info << (pin_workers_ ? " (workers pinned, buffers first-touched per node)" : " (workers unpinned)") << "\n";
+    }
+    info << "  Kernel: " << (function_ ? entry_point_ : std::string("Not Loaded")) << "\n";
+    info << "  Group Size: " << group_size_[0] << "x" << group_size_[1] << "x" << group_size_[2] << "\n";
+    if (has_recording_) {
+        info << "  Recorded Dispatch: " << recorded_.groups[0] << "x" << recorded_.groups[1] << "x" << recorded_.groups[2] << "\n";
+    }
+    if (list_recording_) {
+        info << "  Command List: Recording, " << list_dispatches_.size() << " dispatches\n";
+    }
+    info << "  Global Parameters: " << global_params_.size() << " bytes\n";
+    info << "  Buffer Bindings: " << buffer_bindings_.size();
+    return info.str();
+}
+
+bool CpuKernelRunner::SupportsFeature(const std::string& feature) const {
+    if (feature == "compute") return true;
+    if (feature == "timing") return true;
+    if (feature == "shader_sharedlib") return true;
+    if (feature == "replay") return true;
+    if (feature == "command_list") return true;
+    if (feature == "completion_tokens") return true;
+    if (feature == "buffer_device_address") return true;
+    if (feature == "counters") return true;
+    if (feature == "host_memory_import") return true;
+    return false;
+}
+
+/**
+ * @brief Read the processor model name, falling back to a generic label
+ */
+static std::string QueryHostCpuName() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {
+            size_t colon = line.find(':');
+            if (colon != std::string::npos && colon + 2 <= line.size()) {
+                return line.substr(colon + 2);
+            }
+        }
+    }
+    return "Host CPU";
+}
+
+// CpuKernelRunnerFactory implementation
+std::vector<DeviceInfo> CpuKernelRunnerFactory::EnumerateDevices() const {
+    DeviceInfo host;
+    host.name = QueryHostCpuName();
+    host.backend_type = Backend::CPU;
+    host.api_version = kNativeApiVersion;
+    host.supported_extensions = DetectSimdIsas();
+    host.compute_capability = host.supported_extensions.front();
+    host.max_threads_per_group = 1024;
+    host.multiprocessor_count = QueryWorkerThreadCount();
+    host.is_integrated = true;
+
+#ifndef _WIN32
+    long page_size = sysconf(_SC_PAGESIZE);
+    long total_pages = sysconf(_SC_PHYS_PAGES);
+    long free_pages = sysconf(_SC_AVPHYS_PAGES);
+    if (page_size > 0 && total_pages > 0) {
+        host.total_memory_bytes = static_cast<uint64_t>(page_size) * static_cast<uint64_t>(total_pages);
+    }
+    if (page_size > 0 && free_pages > 0) {
+        host.free_memory_bytes = static_cast<uint64_t>(page_size) * static_cast<uint64_t>(free_pages);
+    }
+#endif
+
+    std::vector<HostNumaNode> nodes = QueryNumaNodes();
+    for (const HostNumaNode& node : nodes) {
+        host.numa_nodes.push_back(node.id);
+        host.numa_node_cpus.push_back(node.cpus);
+    }
+
+    std::vector<DeviceInfo> devices;
+    const char* device_per_node = std::getenv("KERNTOPIA_CPU_DEVICE_PER_NUMA_NODE");
+    if (device_per_node && std::string(device_per_node) == "1" && nodes.size() > 1) {
+        // Each node becomes a device with its own CPUs and memory, for per-socket scaling runs
+        for (const HostNumaNode& node : nodes) {
+            DeviceInfo device = host;
+            device.name += " (NUMA node " + std::to_string(node.id) + ")";
+            device.numa_nodes = {node.id};
+            device.numa_node_cpus = {node.cpus};
+            device.numa_node = static_cast<int>(node.id);
+            device.multiprocessor_count = std::min(host.multiprocessor_count, static_cast<uint32_t>(node.cpus.size()));
+            device.total_memory_bytes = node.total_memory_bytes;
+            device.free_memory_bytes = node.free_memory_bytes;
+            devices.push_back(device);
+        }
+    } else {
+        devices.push_back(host);
+    }
+
+    for (size_t i = 0; i < devices.size(); ++i) {
+        devices[i].device_id = static_cast<int>(i);
+        KERNTOPIA_LOG_INFO(LogComponent::BACKEND, "CPU Device " + std::to_string(i) + ": " + devices[i].name + " (" +
+                          std::to_string(devices[i].multiprocessor_count) + " threads, " + devices[i].compute_capability +
+                          (devices[i].numa_nodes.size() > 1 ? ", " + std::to_string(devices[i].numa_nodes.size()) + " NUMA nodes" : "") + ")");
+    }
+    return devices;
+}
+
+Result<std::unique_ptr<IKernelRunner>> CpuKernelRunnerFactory::CreateRunner(int device_id) const {
+    auto devices = EnumerateDevices();
+    if (device_id < 0 || static_cast<size_t>(device_id) >= devices.size()) {
+        return KERNTOPIA_RESULT_ERROR(std::unique_ptr<IKernelRunner>, ErrorCategory::VALIDATION,
+                                     ErrorCode::INVALID_ARGUMENT,
+                                     "Invalid CPU device ID: " + std::to_string(device_id) + " (available: 0-" +
+                                     std::to_string(devices.size() - 1) + ")");
+    }
+
+    std::unique_ptr<IKernelRunner> runner = std::make_unique<CpuKernelRunner>(device_id, devices[device_id]);
+
+    KERNTOPIA_LOG_INFO(LogComponent::BACKEND, "Created CPU kernel runner for device " + std::to_string(device_id) +
+                       " (" + devices[device_id].name + ")");
+    return Result<std::unique_ptr<IKernelRunner>>::Success(std::move(runner));
+}
+
+} // namespace kerntopia
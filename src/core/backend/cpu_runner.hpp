@@ -0,0 +1,230 @@
+#pragma once
+
+#include "ikernel_runner.hpp"
+#include "cpu_memory.hpp"
+#include "runtime_loader.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace kerntopia {
+
+/**
+ * @brief Group range handed to a Slang host-callable entry point
+ *
+ * Mirrors Slang's ComputeVaryingInput: the kernel runs every group from start (inclusive)
+ * to end (exclusive) in each dimension.
+ */
+struct CpuVaryingInput {
+    uint32_t start_group_id[3] = {0, 0, 0};
+    uint32_t end_group_id[3] = {0, 0, 0};
+};
+
+/**
+ * @brief Signature of the entry points Slang emits for the shader-sharedlib target
+ */
+using CpuKernelFunction = void (*)(CpuVaryingInput* varying_input, void* entry_point_params, void* global_params);
+
+/**
+ * @brief Order in which the CPU runner hands out the groups of a grid
+ *
+ * Each z slice is walked along a Z-order (Morton) curve so consecutive tiles are 2D neighbours;
+ * a grid one group high keeps its linear order.
+ *
+ * @param groups Grid size in groups
+ * @return Every linear group index (z * gx * gy + y * gx + x) exactly once
+ */
+std::vector<uint32_t> BuildMortonTileOrder(const uint32_t groups[3]);
+
+/// Most worker threads the CPU runner starts; larger KERNTOPIA_CPU_THREADS values are clamped to it
+constexpr uint32_t kMaxCpuWorkerThreads = 1024;
+
+/**
+ * @brief Parse a KERNTOPIA_CPU_THREADS value
+ *
+ * Only plain decimal numbers are accepted; signs, trailing characters, zero and values
+ * that overflow fall back. Counts above kMaxCpuWorkerThreads are clamped with a warning.
+ *
+ * @param value Environment value, may be null or empty
+ * @param fallback Count used when the value is missing or invalid
+ * @return Worker thread count in [1, kMaxCpuWorkerThreads], or fallback
+ */
+uint32_t ParseWorkerThreadCount(const char* value, uint32_t fallback);
+
+/**
+ * @brief CPU backend kernel runner implementation
+ *
+ * Runs Slang kernels compiled with the host-callable (shader-sharedlib) target. The compiled
+ * shared object is loaded with the runtime loader and its workgroups are spread across a pool
+ * of worker threads sized to the machine, with the calling thread taking part. Each thread starts
+ * on a contiguous slice of the groups in Morton order (so neighbouring tiles stay in its caches)
+ * and steals half of the largest remaining slice once its own runs dry. Kernels reach
+ * buffers through the pointer block passed to SetSlangGlobalParameters(), laid out like the
+ * CUDA target; SetParameters() supplies the entry point's uniform parameters.
+ *
+ * On hosts with several NUMA nodes (from /sys/devices/system/node) each worker is pinned to a CPU,
+ * with the workers of one node holding adjacent indices so their starting slices form one band of the
+ * tile order per node. New buffers are zeroed by the pool in matching bands, so first touch places each
+ * band's pages on the node that processes it, and thieves look on their own node before crossing over.
+ *
+ * Kernels are built per SIMD level (host, host-avx2, host-avx512) so the compiler vectorizes
+ * each group's thread loop along x; the device reports the ISAs this machine runs, widest first,
+ * in supported_extensions and the widest one as compute_capability for callers picking a variant.
+ *
+ * Work executes before Dispatch(), ReplayRecorded() and SubmitCommandList() return, so every
+ * completion token is reached as soon as it is issued.
+ */
+class CpuKernelRunner : public IKernelRunner {
+public:
+    CpuKernelRunner(int device_id, const DeviceInfo& device_info);
+    ~CpuKernelRunner();
+
+    // IKernelRunner interface implementation
+    std::string GetBackendName() const override { return "CPU"; }
+    std::string GetDeviceName() const override { return device_info_.name; }
+    DeviceInfo GetDeviceInfo() const override { return device_info_; }
+
+    Result<void> LoadKernel(const std::vector<uint8_t>& bytecode, const std::string& entry_point) override;
+    Result<void> SetSpecialization(const KernelSpecialization& specialization) override;
+    Result<void> SetParameters(const void* params, size_t size) override;
+    Result<void> SetBuffer(int binding, std::shared_ptr<IBuffer> buffer) override;
+    Result<void> SetTexture(int binding, std::shared_ptr<ITexture> texture) override;
+    Result<void> Dispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
+    Result<void> WaitForCompletion() override;
+    Result<void> RecordDispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
+    Result<void> ReplayRecorded(uint32_t iterations) override;
+    Result<void> BeginCommandList() override;
+    Result<void> RecordBarrier() override;
+    Result<void> SubmitCommandList() override;
+    Result<void> DispatchPipelined(std::shared_ptr<IBuffer> input, const std::vector<const void*>& frames,
+                                   size_t frame_size, uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
+    uint64_t GetCompletionToken() const override { return completion_token_; }
+    Result<bool> IsTokenComplete(uint64_t token) override;
+    Result<void> WaitForToken(uint64_t token) override;
+    Result<void> SetCounterCollection(bool enable) override;
+    TimingResults GetLastExecutionTime() override;
+    Result<std::shared_ptr<IBuffer>> CreateBuffer(size_t size, IBuffer::Type type, IBuffer::Usage usage) override;
+    Result<std::shared_ptr<ITexture>> CreateTexture(const TextureDesc& desc) override;
+    Result<std::shared_ptr<IBuffer>> WrapHostMemory(void* host_pointer, size_t size, IBuffer::Type type) override;
+    void CalculateDispatchSize(uint32_t width, uint32_t height, uint32_t depth,
+                              uint32_t& groups_x, uint32_t& groups_y, uint32_t& groups_z) override;
+    std::string GetDebugInfo() const override;
+    bool SupportsFeature(const std::string& feature) const override;
+    Result<void> SetSlangGlobalParameters(const void* params, size_t size) override;
+
+private:
+    /**
+     * @brief One dispatch with the kernel and parameter blocks it runs with
+     */
+    struct CpuDispatch {
+        CpuKernelFunction function = nullptr;
+        uint32_t groups[3] = {0, 0, 0};
+        std::vector<uint8_t> entry_point_params;
+        std::vector<uint8_t> global_params;
+    };
+
+    /**
+     * @brief Per-thread scheduler state, padded to a cache line
+     *
+     * range packs the slice [begin, end) of the tile order still queued on the thread as
+     * (begin << 32) | end. The owner takes tiles from the front, thieves split off the back.
+     */
+    struct alignas(64) CpuWorkerState {
+        std::atomic<uint64_t> range{0};
+        uint64_t groups = 0;                      ///< Groups run in the current dispatch
+        uint64_t steals = 0;                      ///< Successful steals in the current dispatch
+        uint64_t stolen_groups = 0;               ///< Groups taken by those steals
+        uint64_t remote_steals = 0;               ///< Steals from a worker on another NUMA node
+        float busy_ms = 0.0f;                     ///< Time from job start until nothing was left to take or steal
+    };
+
+    int device_id_;
+    DeviceInfo device_info_;
+
+    // Loaded kernel library
+    LibraryHandle library_ = nullptr;
+    std::string library_path_;
+    CpuKernelFunction function_ = nullptr;
+    std::string entry_point_;
+    std::vector<std::pair<LibraryHandle, std::string>> retired_libraries_;  // Replaced while a command list still uses them
+
+    // Workgroup size is compiled into the kernel; this only drives CalculateDispatchSize()
+    uint32_t group_size_[3] = {16, 16, 1};        // Matches SLANG [numthreads(16, 16, 1)]
+
+    // Parameter blocks passed to every group
+    std::vector<uint8_t> entry_point_params_;
+    std::vector<uint8_t> global_params_;
+    std::map<int, std::shared_ptr<IBuffer>> buffer_bindings_;    // Kept alive while bound
+    std::map<int, std::shared_ptr<ITexture>> texture_bindings_;
+
+    // Recorded dispatch and command list, captured with copies of their parameter blocks
+    bool has_recording_ = false;
+    CpuDispatch recorded_;
+    bool list_recording_ = false;
+    std::vector<CpuDispatch> list_dispatches_;
+
+    uint64_t completion_token_ = 0;
+    bool collect_counters_ = false;               // SetCounterCollection(true) is in effect
+
+    // Worker pool: workers wake on a new job generation and run tiles until none are left to steal
+    uint32_t thread_count_ = 1;                   // Workers plus the dispatching thread
+    std::unique_ptr<CpuWorkerState[]> worker_states_;  // Index 0 is the dispatching thread
+    std::vector<std::thread> workers_;
+    std::mutex pool_mutex_;
+    std::condition_variable pool_wake_;
+    std::condition_variable pool_done_;
+    uint64_t job_generation_ = 0;
+    uint32_t active_workers_ = 0;
+    bool pool_stop_ = false;
+    const std::function<void(uint32_t)>* job_ = nullptr;  // Run by every thread with its worker index
+
+    // Host placement: worker i runs on worker_cpus_[i] (-1 unpinned) in NUMA node worker_nodes_[i]
+    bool pin_workers_ = false;
+    std::vector<int> worker_cpus_;
+    std::vector<uint32_t> worker_nodes_;
+
+    // Linear group indices in Morton order, rebuilt when the grid changes
+    std::vector<uint32_t> tile_order_;
+    uint32_t tile_order_groups_[3] = {0, 0, 0};
+
+    // Timing results
+    TimingResults last_timing_;
+
+    // Helper methods
+    void StartWorkers();
+    void StopWorkers();
+    void AssignWorkerCpus();
+    void WorkerLoop(uint32_t worker_index);
+    void RunOnPool(const std::function<void(uint32_t)>& job);
+    void FirstTouch(void* data, size_t size);
+    void RunGroups(uint32_t worker_index, const CpuDispatch& dispatch);
+    bool StealTiles(uint32_t thief_index);
+    void BuildTileOrder(const uint32_t groups[3]);
+    float ExecuteDispatch(const CpuDispatch& dispatch);
+    CpuDispatch CaptureDispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) const;
+    void UnloadKernel();
+    void ReleaseLibrary(LibraryHandle library, const std::string& path);
+};
+
+/**
+ * @brief CPU backend factory
+ *
+ * Device 0 is the native runner spanning the whole host. With KERNTOPIA_CPU_DEVICE_PER_NUMA_NODE=1
+ * on a multi-node host there is one native device per NUMA node instead. KERNTOPIA_CPU_THREADS sets
+ * the worker count (default: the hardware concurrency). BackendFactory lists software Vulkan devices
+ * after these under the CPU backend.
+ */
+class CpuKernelRunnerFactory : public IKernelRunnerFactory {
+public:
+    bool IsAvailable() const override { return true; }
+    std::vector<DeviceInfo> EnumerateDevices() const override;
+    Result<std::unique_ptr<IKernelRunner>> CreateRunner(int device_id = 0) const override;
+    Backend GetBackendType() const override { return Backend::CPU; }
+    std::string GetVersion() const override { return "1.0.0"; }
+};
+
+} // namespace kerntopia
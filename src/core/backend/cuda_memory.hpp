@@ -45,6 +45,7 @@ public:
     
     Result<void> UploadData(const void* data, size_t size, size_t offset = 0) override;
     Result<void> DownloadData(void* data, size_t size, size_t offset = 0) override;
+    uint64_t GetDeviceAddress() const override { return static_cast<uint64_t>(device_ptr_); }
     
     // CUDA-specific methods
     CUdeviceptr GetDevicePointer() const { return device_ptr_; }
@@ -35,6 +35,8 @@ typedef CUresult (*cuEventCreate_t)(CUevent* phEvent, unsigned int Flags);
 typedef CUresult (*cuEventDestroy_t)(CUevent hEvent);
 typedef CUresult (*cuEventRecord_t)(CUevent hEvent, CUstream hStream);
 typedef CUresult (*cuEventElapsedTime_t)(float* pMilliseconds, CUevent hStart, CUevent hEnd);
+typedef CUresult (*cuEventQuery_t)(CUevent hEvent);
+typedef CUresult (*cuEventSynchronize_t)(CUevent hEvent);
 typedef CUresult (*cuCtxSynchronize_t)(void);
 typedef CUresult (*cuGetErrorString_t)(CUresult error, const char** pStr);
 #else
@@ -62,6 +64,8 @@ static cuEventCreate_t cu_EventCreate = nullptr;
 static cuEventDestroy_t cu_EventDestroy = nullptr;
 static cuEventRecord_t cu_EventRecord = nullptr;
 static cuEventElapsedTime_t cu_EventElapsedTime = nullptr;
+static cuEventQuery_t cu_EventQuery = nullptr;
+static cuEventSynchronize_t cu_EventSynchronize = nullptr;
 static cuCtxSynchronize_t cu_CtxSynchronize = nullptr;
 // cu_GetErrorString is now defined in cuda_memory.cpp as extern
 
@@ -128,6 +132,10 @@ CudaKernelRunner::~CudaKernelRunner() {
     if (stop_event_ && stop_event_->handle) cu_EventDestroy(stop_event_->handle);
     if (memory_start_event_ && memory_start_event_->handle) cu_EventDestroy(memory_start_event_->handle);
     if (memory_stop_event_ && memory_stop_event_->handle) cu_EventDestroy(memory_stop_event_->handle);
+    for (CUevent event : replay_events_) cu_EventDestroy(event);
+    for (CUevent event : list_events_) cu_EventDestroy(event);
+    for (const auto& token_event : token_events_) cu_EventDestroy(token_event.second);
+    for (CUevent event : free_token_events_) cu_EventDestroy(event);
     
     // Clean up module
     if (module_ && module_->handle) cu_ModuleUnload(module_->handle);
@@ -195,9 +203,13 @@ DeviceInfo CudaKernelRunner::GetDeviceInfo() const {
 Result<void> CudaKernelRunner::LoadKernel(const std::vector<uint8_t>& bytecode, const std::string& entry_point) {
     // Ensure context is current
     cu_CtxSetCurrent(context_->handle);
+    has_recording_ = false;
     
-    // Load PTX module
+    // Load PTX module (includes the driver's JIT compile unless it hits its own compute cache)
+    auto load_start = std::chrono::high_resolution_clock::now();
     CUresult result = cu_ModuleLoadData(&module_->handle, bytecode.data());
+    last_timing_.pipeline_creation_time_ms = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - load_start).count();
     if (result != CUDA_SUCCESS) {
         return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
                                      "Failed to load PTX module: " + CudaErrorToString(result));
@@ -210,11 +222,42 @@ Result<void> CudaKernelRunner::LoadKernel(const std::vector<uint8_t>& bytecode,
                                      "Failed to get kernel function '" + entry_point + "': " + CudaErrorToString(result));
     }
     
-    KERNTOPIA_LOG_INFO(LogComponent::BACKEND, "Loaded CUDA kernel: " + entry_point);
+    std::copy(pending_block_size_, pending_block_size_ + 3, block_size_);
+    KERNTOPIA_LOG_INFO(LogComponent::BACKEND, "Loaded CUDA kernel: " + entry_point + " (block " +
+                      std::to_string(block_size_[0]) + "x" + std::to_string(block_size_[1]) + "x" +
+                      std::to_string(block_size_[2]) + ")");
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CudaKernelRunner::SetSpecialization(const KernelSpecialization& specialization) {
+    // PTX has no specialization constants - only the block size can change after compilation
+    if (!specialization.constants.empty()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "CUDA kernels do not support specialization constants");
+    }
+    
+    static const uint32_t kDefaultBlock[3] = {16, 16, 1};
+    static const uint32_t kMaxBlock[3] = {1024, 1024, 64};
+    uint32_t block[3];
+    for (int d = 0; d < 3; ++d) {
+        block[d] = specialization.local_size[d] != 0 ? specialization.local_size[d] : kDefaultBlock[d];
+        if (block[d] > kMaxBlock[d]) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                         "Block size " + std::to_string(block[d]) + " in dimension " + std::to_string(d) +
+                                         " exceeds CUDA limit " + std::to_string(kMaxBlock[d]));
+        }
+    }
+    if (block[0] * block[1] * block[2] > 1024) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Block of " + std::to_string(block[0] * block[1] * block[2]) +
+                                     " threads exceeds CUDA limit of 1024");
+    }
+    std::copy(block, block + 3, pending_block_size_);
     return KERNTOPIA_VOID_SUCCESS();
 }
 
 Result<void> CudaKernelRunner::SetParameters(const void* params, size_t size) {
+    has_recording_ = false;
     parameter_buffer_.resize(size);
     std::memcpy(parameter_buffer_.data(), params, size);
     return KERNTOPIA_VOID_SUCCESS();
@@ -263,6 +306,7 @@ Result<void> CudaKernelRunner::SetBuffer(int binding, std::shared_ptr<IBuffer> b
     }
     
     buffer_bindings_[binding] = cuda_buffer->GetDevicePointer();
+    has_recording_ = false;
     return KERNTOPIA_VOID_SUCCESS();
 }
 
@@ -274,38 +318,68 @@ Result<void> CudaKernelRunner::SetTexture(int binding, std::shared_ptr<ITexture>
     }
     
     buffer_bindings_[binding] = cuda_texture->GetDevicePointer();
+    has_recording_ = false;
     return KERNTOPIA_VOID_SUCCESS();
 }
 
+CUresult CudaKernelRunner::LaunchKernel(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) {
+    // Prepare kernel arguments (simplified - assuming buffer pointers)
+    std::vector<CUdeviceptr> args;
+    for (const auto& binding : buffer_bindings_) {
+        args.push_back(binding.second);
+    }
+    
+    const uint32_t groups[3] = {groups_x, groups_y, groups_z};
+    return LaunchKernel(function_->handle, groups, block_size_, args);
+}
+
+CUresult CudaKernelRunner::LaunchKernel(CUfunction function, const uint32_t groups[3], const uint32_t block[3], std::vector<CUdeviceptr>& args) {
+    std::vector<void*> arg_pointers;
+    for (auto& arg : args) {
+        arg_pointers.push_back(&arg);
+    }
+    
+    return cu_LaunchKernel(
+        function,
+        groups[0], groups[1], groups[2],  // Grid dimensions
+        block[0], block[1], block[2],     // Block dimensions
+        0,                                // Shared memory
+        nullptr,                          // Stream
+        arg_pointers.empty() ? nullptr : arg_pointers.data(),  // Kernel arguments
+        nullptr                           // Extra
+    );
+}
+
 Result<void> CudaKernelRunner::Dispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) {
     if (!function_->handle) {
         return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_NOT_AVAILABLE,
                                      "No kernel loaded");
     }
     
+    // Inside BeginCommandList/SubmitCommandList the launch is captured for the list
+    if (list_recording_) {
+        ListLaunch& launch = list_launches_.emplace_back();
+        launch.function = function_->handle;
+        launch.groups[0] = groups_x;
+        launch.groups[1] = groups_y;
+        launch.groups[2] = groups_z;
+        std::copy(block_size_, block_size_ + 3, launch.block);
+        for (const auto& binding : buffer_bindings_) {
+            launch.args.push_back(binding.second);
+        }
+        return KERNTOPIA_VOID_SUCCESS();
+    }
+    
     // Ensure context is current
     cu_CtxSetCurrent(context_->handle);
+    replay_iterations_ = 0;
+    list_dispatches_ = 0;
     
     // Record start timing
     auto start_time = std::chrono::steady_clock::now();
     cu_EventRecord(start_event_->handle, nullptr);
     
-    // Prepare kernel arguments (simplified - assuming buffer pointers)
-    std::vector<void*> args;
-    for (auto& binding : buffer_bindings_) {
-        args.push_back(&binding.second);
-    }
-    
-    // Launch kernel with 16x16 thread blocks (matching SLANG [numthreads(16, 16, 1)])
-    CUresult result = cu_LaunchKernel(
-        function_->handle,
-        groups_x, groups_y, groups_z,  // Grid dimensions
-        16, 16, 1,                     // Block dimensions
-        0,                             // Shared memory
-        nullptr,                       // Stream
-        args.empty() ? nullptr : args.data(),  // Kernel arguments
-        nullptr                        // Extra
-    );
+    CUresult result = LaunchKernel(groups_x, groups_y, groups_z);
     
     if (result != CUDA_SUCCESS) {
         return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
@@ -320,12 +394,286 @@ Result<void> CudaKernelRunner::Dispatch(uint32_t groups_x, uint32_t groups_y, ui
     last_timing_.start_time = start_time;
     last_timing_.end_time = end_time;
     
+    auto token_result = IssueCompletionToken();
+    if (!token_result) {
+        return token_result;
+    }
+    
     KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Dispatched CUDA kernel: " + 
                        std::to_string(groups_x) + "x" + std::to_string(groups_y) + "x" + std::to_string(groups_z));
     
     return KERNTOPIA_VOID_SUCCESS();
 }
 
+Result<void> CudaKernelRunner::RecordDispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) {
+    if (!function_->handle) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_NOT_AVAILABLE,
+                                     "No kernel loaded");
+    }
+    
+    recorded_groups_[0] = groups_x;
+    recorded_groups_[1] = groups_y;
+    recorded_groups_[2] = groups_z;
+    has_recording_ = true;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CudaKernelRunner::ReplayRecorded(uint32_t iterations) {
+    if (!has_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "No recorded dispatch to replay (bindings or parameters changed since RecordDispatch?)");
+    }
+    if (iterations == 0) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Replay iteration count cannot be zero");
+    }
+    
+    // Ensure context is current
+    cu_CtxSetCurrent(context_->handle);
+    
+    // One event per iteration boundary; launches on the null stream serialize, so event i+1 closes iteration i
+    while (replay_events_.size() < iterations + 1) {
+        CUevent event = nullptr;
+        CUresult result = cu_EventCreate(&event, 0);
+        if (result != CUDA_SUCCESS) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         "Failed to create replay event: " + CudaErrorToString(result));
+        }
+        replay_events_.push_back(event);
+    }
+    
+    auto start_time = std::chrono::steady_clock::now();
+    cu_EventRecord(replay_events_[0], nullptr);
+    for (uint32_t i = 0; i < iterations; ++i) {
+        CUresult result = LaunchKernel(recorded_groups_[0], recorded_groups_[1], recorded_groups_[2]);
+        if (result != CUDA_SUCCESS) {
+            replay_iterations_ = 0;
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         "Failed to launch replayed CUDA kernel: " + CudaErrorToString(result));
+        }
+        cu_EventRecord(replay_events_[i + 1], nullptr);
+    }
+    
+    replay_iterations_ = iterations;
+    list_dispatches_ = 0;
+    last_timing_.start_time = start_time;
+    
+    auto token_result = IssueCompletionToken();
+    if (!token_result) {
+        return token_result;
+    }
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Replayed CUDA kernel " + std::to_string(iterations) + " times");
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CudaKernelRunner::BeginCommandList() {
+    if (list_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "A command list is already being recorded");
+    }
+    
+    list_launches_.clear();
+    list_recording_ = true;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CudaKernelRunner::RecordBarrier() {
+    if (!list_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "RecordBarrier requires an open command list");
+    }
+    
+    // Launches on the null stream already execute in order, so there is nothing to record
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CudaKernelRunner::SubmitCommandList() {
+    if (!list_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "No command list is being recorded");
+    }
+    list_recording_ = false;
+    if (list_launches_.empty()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Command list has no dispatches");
+    }
+    
+    // Ensure context is current
+    cu_CtxSetCurrent(context_->handle);
+    
+    while (list_events_.size() < list_launches_.size() * 2) {
+        CUevent event = nullptr;
+        CUresult result = cu_EventCreate(&event, 0);
+        if (result != CUDA_SUCCESS) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         "Failed to create command list event: " + CudaErrorToString(result));
+        }
+        list_events_.push_back(event);
+    }
+    
+    // Stream-ordered launches back to back, each bracketed by an event pair
+    auto start_time = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < list_launches_.size(); ++i) {
+        cu_EventRecord(list_events_[i * 2], nullptr);
+        CUresult result = LaunchKernel(list_launches_[i].function, list_launches_[i].groups, list_launches_[i].block, list_launches_[i].args);
+        if (result != CUDA_SUCCESS) {
+            list_dispatches_ = 0;
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         "Failed to launch command list dispatch " + std::to_string(i) + ": " +
+                                         CudaErrorToString(result));
+        }
+        cu_EventRecord(list_events_[i * 2 + 1], nullptr);
+    }
+    
+    replay_iterations_ = 0;
+    list_dispatches_ = static_cast<uint32_t>(list_launches_.size());
+    last_timing_.start_time = start_time;
+    list_launches_.clear();
+    
+    auto token_result = IssueCompletionToken();
+    if (!token_result) {
+        return token_result;
+    }
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Submitted CUDA command list: " + std::to_string(list_dispatches_) + " launches");
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CudaKernelRunner::DispatchPipelined(std::shared_ptr<IBuffer> input, const std::vector<const void*>& frames,
+                                                 size_t frame_size, uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) {
+    if (!input || frames.empty() || frame_size == 0 || frame_size > input->GetSize()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Pipelined run needs an input buffer and at least one frame that fits it");
+    }
+    if (list_recording_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Pipelined run cannot be recorded into a command list");
+    }
+    
+    // Uploads use synchronous copies on the default stream, so frames run back to back without overlap
+    float upload_ms = 0.0f;
+    auto run_frame = [&](const void* frame) -> Result<void> {
+        auto upload_start = std::chrono::high_resolution_clock::now();
+        auto upload_result = input->UploadData(frame, frame_size);
+        if (!upload_result) {
+            return upload_result;
+        }
+        upload_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - upload_start).count();
+        auto dispatch_result = Dispatch(groups_x, groups_y, groups_z);
+        if (!dispatch_result) {
+            return dispatch_result;
+        }
+        return WaitForCompletion();
+    };
+    
+    auto reference_start = std::chrono::high_resolution_clock::now();
+    auto frame_result = run_frame(frames[0]);
+    if (!frame_result) {
+        return frame_result;
+    }
+    float reference_upload_ms = upload_ms;
+    float frame_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - reference_start).count();
+    
+    auto pipeline_start = std::chrono::high_resolution_clock::now();
+    for (const void* frame : frames) {
+        frame_result = run_frame(frame);
+        if (!frame_result) {
+            return frame_result;
+        }
+    }
+    
+    last_timing_.memory_setup_time_ms = reference_upload_ms;
+    last_timing_.compute_time_ms = std::max(0.0f, frame_ms - reference_upload_ms);
+    last_timing_.total_time_ms = std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - pipeline_start).count();
+    last_timing_.transfer_overlap = 0.0f;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CudaKernelRunner::SetCounterCollection(bool enable) {
+    if (enable) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_NOT_AVAILABLE,
+                                     "CUDA device counters require CUPTI, which is not loaded");
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> CudaKernelRunner::IssueCompletionToken() {
+    // Recycle events of tokens that have already been reached
+    while (!token_events_.empty() && cu_EventQuery(token_events_.front().second) == CUDA_SUCCESS) {
+        free_token_events_.push_back(token_events_.front().second);
+        token_events_.pop_front();
+    }
+    
+    CUevent event = nullptr;
+    if (!free_token_events_.empty()) {
+        event = free_token_events_.back();
+        free_token_events_.pop_back();
+    } else {
+        CUresult result = cu_EventCreate(&event, CU_EVENT_DISABLE_TIMING);
+        if (result != CUDA_SUCCESS) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         "Failed to create completion token event: " + CudaErrorToString(result));
+        }
+    }
+    
+    cu_EventRecord(event, nullptr);
+    token_events_.emplace_back(++completion_token_, event);
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+CUevent CudaKernelRunner::FindTokenEvent(uint64_t token) const {
+    // The null stream completes in order, so the newest event at or before the token covers it
+    CUevent event = nullptr;
+    for (const auto& token_event : token_events_) {
+        if (token_event.first > token) {
+            break;
+        }
+        event = token_event.second;
+    }
+    return event;
+}
+
+Result<bool> CudaKernelRunner::IsTokenComplete(uint64_t token) {
+    if (token > completion_token_) {
+        return KERNTOPIA_RESULT_ERROR(bool, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Completion token " + std::to_string(token) + " has not been issued");
+    }
+    CUevent event = FindTokenEvent(token);
+    if (!event) {
+        return Result<bool>::Success(true);
+    }
+    
+    CUresult result = cu_EventQuery(event);
+    if (result == CUDA_ERROR_NOT_READY) {
+        return Result<bool>::Success(false);
+    }
+    if (result != CUDA_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(bool, ErrorCategory::BACKEND, ErrorCode::KERNEL_EXECUTION_FAILED,
+                                     "Failed to query completion token: " + CudaErrorToString(result));
+    }
+    return Result<bool>::Success(true);
+}
+
+Result<void> CudaKernelRunner::WaitForToken(uint64_t token) {
+    if (token > completion_token_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Completion token " + std::to_string(token) + " has not been issued");
+    }
+    CUevent event = FindTokenEvent(token);
+    if (!event) {
+        return KERNTOPIA_VOID_SUCCESS();
+    }
+    
+    CUresult result = cu_EventSynchronize(event);
+    if (result != CUDA_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::KERNEL_EXECUTION_FAILED,
+                                     "Failed to wait for completion token: " + CudaErrorToString(result));
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
 Result<void> CudaKernelRunner::WaitForCompletion() {
     CUresult result = cu_CtxSynchronize();
     if (result != CUDA_SUCCESS) {
@@ -333,11 +681,53 @@ Result<void> CudaKernelRunner::WaitForCompletion() {
                                      "CUDA synchronization failed: " + CudaErrorToString(result));
     }
     
+    // Every issued token has been reached
+    for (const auto& token_event : token_events_) {
+        free_token_events_.push_back(token_event.second);
+    }
+    token_events_.clear();
+    
     // Calculate execution time
-    float elapsed_ms = 0.0f;
-    result = cu_EventElapsedTime(&elapsed_ms, start_event_->handle, stop_event_->handle);
-    if (result == CUDA_SUCCESS) {
-        last_timing_.compute_time_ms = elapsed_ms;
+    last_timing_.iteration_times_ms.clear();
+    last_timing_.dispatch_times_ms.clear();
+    if (list_dispatches_ > 0) {
+        // Host view of a list is the whole submission, first launch to synchronization
+        last_timing_.end_time = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < list_dispatches_; ++i) {
+            float elapsed_ms = 0.0f;
+            if (cu_EventElapsedTime(&elapsed_ms, list_events_[i * 2], list_events_[i * 2 + 1]) != CUDA_SUCCESS) {
+                break;
+            }
+            last_timing_.dispatch_times_ms.push_back(elapsed_ms);
+        }
+        float list_ms = 0.0f;
+        if (cu_EventElapsedTime(&list_ms, list_events_[0], list_events_[list_dispatches_ * 2 - 1]) == CUDA_SUCCESS) {
+            last_timing_.device_time_ms = list_ms;
+            last_timing_.compute_time_ms = list_ms;
+        }
+    } else if (replay_iterations_ > 0) {
+        // Host view of a replay is the whole batch, launch to synchronization
+        last_timing_.end_time = std::chrono::steady_clock::now();
+        float sum_ms = 0.0f;
+        for (uint32_t i = 0; i < replay_iterations_; ++i) {
+            float elapsed_ms = 0.0f;
+            if (cu_EventElapsedTime(&elapsed_ms, replay_events_[i], replay_events_[i + 1]) != CUDA_SUCCESS) {
+                break;
+            }
+            last_timing_.iteration_times_ms.push_back(elapsed_ms);
+            sum_ms += elapsed_ms;
+        }
+        if (!last_timing_.iteration_times_ms.empty()) {
+            last_timing_.device_time_ms = sum_ms / last_timing_.iteration_times_ms.size();
+            last_timing_.compute_time_ms = last_timing_.device_time_ms;
+        }
+    } else {
+        float elapsed_ms = 0.0f;
+        result = cu_EventElapsedTime(&elapsed_ms, start_event_->handle, stop_event_->handle);
+        if (result == CUDA_SUCCESS) {
+            last_timing_.compute_time_ms = elapsed_ms;
+            last_timing_.device_time_ms = elapsed_ms;
+        }
     }
     
     auto duration = last_timing_.end_time - last_timing_.start_time;
@@ -370,12 +760,20 @@ Result<std::shared_ptr<ITexture>> CudaKernelRunner::CreateTexture(const TextureD
     return Result<std::shared_ptr<ITexture>>::Success(texture);
 }
 
+Result<std::shared_ptr<IBuffer>> CudaKernelRunner::WrapHostMemory([[maybe_unused]] void* host_pointer,
+                                                                  [[maybe_unused]] size_t size,
+                                                                  [[maybe_unused]] IBuffer::Type type) {
+    // Kernels take device memory; mapped host registration (cuMemHostRegister) is not loaded
+    return KERNTOPIA_RESULT_ERROR(std::shared_ptr<IBuffer>, ErrorCategory::BACKEND, ErrorCode::BACKEND_NOT_AVAILABLE,
+                                 "CUDA buffers cannot wrap host memory; use CreateBuffer");
+}
+
 void CudaKernelRunner::CalculateDispatchSize(uint32_t width, uint32_t height, uint32_t depth,
                                             uint32_t& groups_x, uint32_t& groups_y, uint32_t& groups_z) {
-    // Calculate number of thread groups needed for 16x16 thread blocks
-    groups_x = (width + 15) / 16;
-    groups_y = (height + 15) / 16;
-    groups_z = std::max(1u, depth);
+    // Calculate number of thread blocks needed for the current block size
+    groups_x = (width + block_size_[0] - 1) / block_size_[0];
+    groups_y = (height + block_size_[1] - 1) / block_size_[1];
+    groups_z = (std::max(1u, depth) + block_size_[2] - 1) / block_size_[2];
 }
 
 std::string CudaKernelRunner::GetDebugInfo() const {
@@ -386,6 +784,13 @@ std::string CudaKernelRunner::GetDebugInfo() const {
     info << "  Context: " << (context_->handle ? "Valid" : "Invalid") << "\n";
     info << "  Module: " << (module_->handle ? "Loaded" : "Not Loaded") << "\n";
     info << "  Function: " << (function_->handle ? "Ready" : "Not Ready") << "\n";
+    info << "  Block Size: " << block_size_[0] << "x" << block_size_[1] << "x" << block_size_[2] << "\n";
+    if (has_recording_) {
+        info << "  Recorded Dispatch: " << recorded_groups_[0] << "x" << recorded_groups_[1] << "x" << recorded_groups_[2] << "\n";
+    }
+    if (list_recording_) {
+        info << "  Command List: Recording, " << list_launches_.size() << " dispatches\n";
+    }
     info << "  Buffer Bindings: " << buffer_bindings_.size();
     return info.str();
 }
@@ -394,6 +799,10 @@ bool CudaKernelRunner::SupportsFeature(const std::string& feature) const {
     if (feature == "compute") return true;
     if (feature == "timing") return true;
     if (feature == "ptx") return true;
+    if (feature == "replay") return true;
+    if (feature == "command_list") return true;
+    if (feature == "specialization") return true;
+    if (feature == "completion_tokens") return true;
     return false;
 }
 
@@ -475,6 +884,8 @@ static Result<void> InitializeCudaDriver() {
     cu_EventDestroy = reinterpret_cast<cuEventDestroy_t>(loader.GetSymbol(cuda_driver_handle, "cuEventDestroy_v2"));
     cu_EventRecord = reinterpret_cast<cuEventRecord_t>(loader.GetSymbol(cuda_driver_handle, "cuEventRecord"));
     cu_EventElapsedTime = reinterpret_cast<cuEventElapsedTime_t>(loader.GetSymbol(cuda_driver_handle, "cuEventElapsedTime"));
+    cu_EventQuery = reinterpret_cast<cuEventQuery_t>(loader.GetSymbol(cuda_driver_handle, "cuEventQuery"));
+    cu_EventSynchronize = reinterpret_cast<cuEventSynchronize_t>(loader.GetSymbol(cuda_driver_handle, "cuEventSynchronize"));
     cu_CtxSynchronize = reinterpret_cast<cuCtxSynchronize_t>(loader.GetSymbol(cuda_driver_handle, "cuCtxSynchronize"));
     cu_GetErrorString = reinterpret_cast<cuGetErrorString_t>(loader.GetSymbol(cuda_driver_handle, "cuGetErrorString"));
     
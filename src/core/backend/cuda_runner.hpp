@@ -5,6 +5,7 @@
 #include "../system/system_interrogator.hpp"
 #include <memory>
 #include <map>
+#include <deque>
 #include <chrono>
 
 // Require CUDA headers - fail compilation if not available
@@ -39,14 +40,27 @@ public:
     DeviceInfo GetDeviceInfo() const override;
     
     Result<void> LoadKernel(const std::vector<uint8_t>& bytecode, const std::string& entry_point) override;
+    Result<void> SetSpecialization(const KernelSpecialization& specialization) override;
     Result<void> SetParameters(const void* params, size_t size) override;
     Result<void> SetBuffer(int binding, std::shared_ptr<IBuffer> buffer) override;
     Result<void> SetTexture(int binding, std::shared_ptr<ITexture> texture) override;
     Result<void> Dispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
     Result<void> WaitForCompletion() override;
+    Result<void> RecordDispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
+    Result<void> ReplayRecorded(uint32_t iterations) override;
+    Result<void> BeginCommandList() override;
+    Result<void> RecordBarrier() override;
+    Result<void> SubmitCommandList() override;
+    Result<void> DispatchPipelined(std::shared_ptr<IBuffer> input, const std::vector<const void*>& frames,
+                                   size_t frame_size, uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
+    uint64_t GetCompletionToken() const override { return completion_token_; }
+    Result<bool> IsTokenComplete(uint64_t token) override;
+    Result<void> WaitForToken(uint64_t token) override;
+    Result<void> SetCounterCollection(bool enable) override;
     TimingResults GetLastExecutionTime() override;
     Result<std::shared_ptr<IBuffer>> CreateBuffer(size_t size, IBuffer::Type type, IBuffer::Usage usage) override;
     Result<std::shared_ptr<ITexture>> CreateTexture(const TextureDesc& desc) override;
+    Result<std::shared_ptr<IBuffer>> WrapHostMemory(void* host_pointer, size_t size, IBuffer::Type type) override;
     void CalculateDispatchSize(uint32_t width, uint32_t height, uint32_t depth,
                               uint32_t& groups_x, uint32_t& groups_y, uint32_t& groups_z) override;
     std::string GetDebugInfo() const override;
@@ -63,12 +77,39 @@ private:
     std::unique_ptr<CudaModule> module_;
     std::unique_ptr<CudaFunction> function_;
     
+    // Thread block size is a launch parameter; the SetSpecialization value takes effect at LoadKernel
+    uint32_t block_size_[3] = {16, 16, 1};          // Matches SLANG [numthreads(16, 16, 1)] by default
+    uint32_t pending_block_size_[3] = {16, 16, 1};
+    
     // Timing events
     std::unique_ptr<CudaEvent> start_event_;
     std::unique_ptr<CudaEvent> stop_event_;
     std::unique_ptr<CudaEvent> memory_start_event_;
     std::unique_ptr<CudaEvent> memory_stop_event_;
     
+    // Recorded dispatch (a launch is reissued from the stored grid, so there is nothing else to capture)
+    bool has_recording_ = false;
+    uint32_t recorded_groups_[3] = {0, 0, 0};
+    std::vector<CUevent> replay_events_;    // Iteration boundaries of the last replay
+    uint32_t replay_iterations_ = 0;        // Iterations of the pending replay, 0 after a plain Dispatch
+    
+    // Command list: launches are captured with their kernel and arguments and issued together on submit
+    struct ListLaunch {
+        CUfunction function = nullptr;
+        uint32_t groups[3] = {0, 0, 0};
+        uint32_t block[3] = {16, 16, 1};
+        std::vector<CUdeviceptr> args;
+    };
+    bool list_recording_ = false;
+    std::vector<ListLaunch> list_launches_;
+    std::vector<CUevent> list_events_;      // Start/stop pair per launch of the last submitted list
+    uint32_t list_dispatches_ = 0;          // Launches of the pending list, 0 otherwise
+    
+    // Completion tokens: an event recorded after each submission, oldest first
+    uint64_t completion_token_ = 0;
+    std::deque<std::pair<uint64_t, CUevent>> token_events_;
+    std::vector<CUevent> free_token_events_;
+    
     // Parameter management
     std::vector<uint8_t> parameter_buffer_;
     std::map<int, CUdeviceptr> buffer_bindings_;  // binding -> device pointer
@@ -79,6 +120,10 @@ private:
     // Helper methods
     Result<void> InitializeCudaContext();
     Result<void> CreateTimingEvents();
+    Result<void> IssueCompletionToken();
+    CUevent FindTokenEvent(uint64_t token) const;
+    CUresult LaunchKernel(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z);
+    CUresult LaunchKernel(CUfunction function, const uint32_t groups[3], const uint32_t block[3], std::vector<CUdeviceptr>& args);
 };
 
 /**
@@ -7,7 +7,9 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <memory>
+#include <new>
 #include <cstdint>
 
 namespace kerntopia {
@@ -29,13 +31,13 @@ struct DeviceInfo {
     uint64_t free_memory_bytes = 0;              ///< Currently free memory
     
     // Compute capabilities
-    std::string compute_capability;              ///< Compute capability (e.g., "7.5" for CUDA)
+    std::string compute_capability;              ///< Compute capability (e.g., "7.5" for CUDA, widest SIMD ISA such as "avx2" for CPU)
     uint32_t max_threads_per_group = 0;          ///< Maximum threads per workgroup
     uint32_t max_shared_memory_bytes = 0;        ///< Maximum shared memory per group
     
     // API support
     std::string api_version;                     ///< API version string
-    std::vector<std::string> supported_extensions; ///< Supported extensions
+    std::vector<std::string> supported_extensions; ///< Supported extensions (SIMD ISAs, widest first, for CPU)
     
     // Performance characteristics
     uint32_t multiprocessor_count = 0;           ///< Number of SMs/CUs
@@ -46,6 +48,12 @@ struct DeviceInfo {
     bool is_integrated = false;                  ///< True for integrated GPUs
     bool supports_compute = true;                ///< Compute shader support
     bool supports_graphics = false;              ///< Graphics support (not needed for Kerntopia)
+    bool supports_counters = false;              ///< Device counter queries (Vulkan pipeline statistics)
+    
+    // Host topology (CPU backend)
+    std::vector<uint32_t> numa_nodes;            ///< NUMA nodes the device runs on
+    std::vector<std::vector<uint32_t>> numa_node_cpus; ///< Logical CPUs of each entry in numa_nodes
+    int numa_node = -1;                          ///< NUMA node the device is bound to, -1 when it spans the host
     
     /**
      * @brief Check if device meets minimum requirements
@@ -66,6 +74,33 @@ struct DeviceInfo {
     }
 };
 
+/**
+ * @brief Page-aligned allocator for host arrays handed to IKernelRunner::WrapHostMemory()
+ * 
+ * Allocations cover whole pages, so importing the pages that hold the data never reaches
+ * into a neighbouring allocation.
+ */
+template <typename T>
+struct HostImportAllocator {
+    using value_type = T;
+    static constexpr size_t kAlignment = 4096;
+    
+    HostImportAllocator() = default;
+    template <typename U>
+    HostImportAllocator(const HostImportAllocator<U>&) {}
+    
+    T* allocate(size_t count) {
+        size_t bytes = (count * sizeof(T) + kAlignment - 1) / kAlignment * kAlignment;
+        return static_cast<T*>(::operator new(bytes, std::align_val_t(kAlignment)));
+    }
+    void deallocate(T* pointer, size_t) { ::operator delete(pointer, std::align_val_t(kAlignment)); }
+    
+    template <typename U>
+    bool operator==(const HostImportAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const HostImportAllocator<U>&) const { return false; }
+};
+
 /**
  * @brief Abstract GPU buffer interface for cross-backend compatibility
  */
@@ -116,6 +151,9 @@ public:
     /**
      * @brief Upload data to buffer
      * 
+     * Safe to call while dispatches are in flight: host-visible implementations wait for
+     * work already submitted to the device before writing mapped memory.
+     * 
      * @param data Source data
      * @param size Data size in bytes
      * @param offset Offset in buffer
@@ -126,12 +164,25 @@ public:
     /**
      * @brief Download data from buffer
      * 
+     * Returns the contents after all work already submitted to the device; host-visible
+     * implementations block on it before reading mapped memory.
+     * 
      * @param data Destination data
      * @param size Data size in bytes  
      * @param offset Offset in buffer
      * @return Success result
      */
     virtual Result<void> DownloadData(void* data, size_t size, size_t offset = 0) = 0;
+    
+    /**
+     * @brief Get the device address kernels use to reach this buffer through a pointer
+     * 
+     * Lets pointer-based kernel parameters be packed the same way on every backend
+     * (see IKernelRunner::SetSlangGlobalParameters).
+     * 
+     * @return 64-bit device address, or 0 if the backend cannot expose one for this buffer
+     */
+    virtual uint64_t GetDeviceAddress() const = 0;
 };
 
 /**
@@ -202,6 +253,19 @@ public:
     virtual Result<void> DownloadData(void* data, size_t data_size, uint32_t mip_level = 0, uint32_t array_layer = 0) = 0;
 };
 
+/**
+ * @brief Load-time specialization applied when a kernel is loaded
+ * 
+ * Lets one compiled kernel run with different workgroup sizes and tuning constants
+ * without recompiling the Slang source.
+ */
+struct KernelSpecialization {
+    uint32_t local_size[3] = {0, 0, 0};         ///< Workgroup size override per dimension (0 keeps the kernel's value)
+    std::map<uint32_t, uint32_t> constants;     ///< Specialization constant values by constant_id (raw bits for floats)
+    
+    bool IsEmpty() const { return local_size[0] == 0 && local_size[1] == 0 && local_size[2] == 0 && constants.empty(); }
+};
+
 /**
  * @brief Abstract kernel runner interface for cross-backend GPU execution
  * 
@@ -248,6 +312,17 @@ public:
     virtual Result<void> LoadKernel(const std::vector<uint8_t>& bytecode, 
                                    const std::string& entry_point) = 0;
     
+    /**
+     * @brief Set the specialization used by subsequent LoadKernel() calls
+     * 
+     * The currently loaded kernel is not affected until it is loaded again.
+     * CalculateDispatchSize() follows the specialized workgroup size.
+     * 
+     * @param specialization Workgroup size and constant overrides (empty restores the kernel defaults)
+     * @return Success result, or error if the backend cannot apply the overrides
+     */
+    virtual Result<void> SetSpecialization(const KernelSpecialization& specialization) = 0;
+    
     /**
      * @brief Set uniform/constant parameters for kernel
      * 
@@ -294,6 +369,130 @@ public:
      */
     virtual Result<void> WaitForCompletion() = 0;
     
+    /**
+     * @brief Record a dispatch of the current kernel, bindings and parameters for replay
+     * 
+     * The recording captures the state at the time of the call. Changing the kernel,
+     * buffers or parameters afterwards invalidates it.
+     * 
+     * @param groups_x Number of thread groups in X dimension
+     * @param groups_y Number of thread groups in Y dimension
+     * @param groups_z Number of thread groups in Z dimension
+     * @return Success result
+     */
+    virtual Result<void> RecordDispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) = 0;
+    
+    /**
+     * @brief Execute the recorded dispatch back to back without re-recording it
+     * 
+     * Asynchronous like Dispatch(). After WaitForCompletion() the timing results report
+     * the per-iteration mean as device time and each iteration in iteration_times_ms.
+     * 
+     * @param iterations Number of times to execute the recorded dispatch
+     * @return Success result
+     */
+    virtual Result<void> ReplayRecorded(uint32_t iterations) = 0;
+    
+    // Command lists
+    
+    /**
+     * @brief Start recording a command list
+     * 
+     * Until SubmitCommandList(), Dispatch() appends to the list instead of submitting.
+     * LoadKernel(), SetBuffer() and SetParameters() may be called between dispatches
+     * to switch kernels or bindings for the dispatches that follow.
+     * 
+     * @return Success result
+     */
+    virtual Result<void> BeginCommandList() = 0;
+    
+    /**
+     * @brief Make later dispatches in the open command list wait for earlier writes
+     * 
+     * Without a barrier, consecutive dispatches in a list may overlap on the device.
+     * 
+     * @return Success result
+     */
+    virtual Result<void> RecordBarrier() = 0;
+    
+    /**
+     * @brief Submit the open command list in one submission
+     * 
+     * Asynchronous like Dispatch(). After WaitForCompletion() the timing results report
+     * the whole list as device time and each dispatch in dispatch_times_ms.
+     * 
+     * @return Success result
+     */
+    virtual Result<void> SubmitCommandList() = 0;
+    
+    // Pipelined streaming
+    
+    /**
+     * @brief Stream input frames through the loaded kernel, overlapping uploads with compute
+     * 
+     * Each frame is uploaded into one of two device-side slots while the previous frame
+     * computes, then copied to the start of @p input and dispatched with the current bindings
+     * and parameters. Uses the device's dedicated transfer queue when it has one. Blocks until
+     * every frame has completed.
+     * 
+     * Frame 0 is first run serially as a reference. The timing results then report that
+     * frame's upload as memory_setup_time_ms and its compute as compute_time_ms, the pipelined
+     * wall time for all frames as total_time_ms, and the achieved overlap as transfer_overlap.
+     * 
+     * @param input Buffer the kernel reads frames from (bound by the caller)
+     * @param frames Host data of each frame, frame_size bytes each
+     * @param frame_size Bytes per frame
+     * @return Success result or error
+     */
+    virtual Result<void> DispatchPipelined(std::shared_ptr<IBuffer> input, const std::vector<const void*>& frames,
+                                           size_t frame_size, uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) = 0;
+    
+    // Completion tokens
+    
+    /**
+     * @brief Get the completion token of the most recently submitted work
+     * 
+     * Every submitted dispatch, replay or command list issues a token one higher than the
+     * last, as do device copies on backends that queue them. A token is complete once its
+     * work and all work submitted before it has finished. Read it right after the call whose
+     * completion you want to track.
+     * 
+     * @return Latest token, 0 if nothing has been submitted yet
+     */
+    virtual uint64_t GetCompletionToken() const = 0;
+    
+    /**
+     * @brief Check without blocking whether a completion token has been reached
+     * 
+     * @param token Token from GetCompletionToken()
+     * @return True if the work behind the token has finished
+     */
+    virtual Result<bool> IsTokenComplete(uint64_t token) = 0;
+    
+    /**
+     * @brief Block until a completion token has been reached
+     * 
+     * Later submissions keep running. Timing results are still collected by WaitForCompletion().
+     * 
+     * @param token Token from GetCompletionToken()
+     * @return Success result
+     */
+    virtual Result<void> WaitForToken(uint64_t token) = 0;
+    
+    /**
+     * @brief Wrap subsequent dispatches in device counter queries
+     * 
+     * When enabled, the timing results of each completed Dispatch() carry the counters in
+     * TimingResults::counters: compute_shader_invocations as counted by the device and
+     * dispatched_invocations (groups times workgroup size) for comparison. The CPU backend has
+     * no device counters and reports its scheduler instead: steals, stolen_groups, remote_steals
+     * (taken from another NUMA node) and per-thread thread_<i>_busy_ms and thread_<i>_groups.
+     * 
+     * @param enable True to collect counters, false to stop
+     * @return Success result, or error if the device has no counter queries
+     */
+    virtual Result<void> SetCounterCollection(bool enable) = 0;
+    
     /**
      * @brief Get timing information from last kernel execution
      * 
@@ -323,6 +522,25 @@ public:
      */
     virtual Result<std::shared_ptr<ITexture>> CreateTexture(const TextureDesc& desc) = 0;
     
+    /**
+     * @brief Wrap existing host memory in a buffer without copying it
+     * 
+     * Kernels read and write @p host_pointer in place: UploadData()/DownloadData() from that
+     * same memory have nothing to copy, and results are there once the work completes. The
+     * memory must outlive the buffer and stay untouched by the host while kernels use it.
+     * Vulkan imports it through VK_EXT_external_memory_host and needs it aligned to the
+     * device's minImportedHostPointerAlignment, a page on common drivers (see
+     * HostImportAllocator); the CPU backend aliases it directly. Devices where this is
+     * not a win over copies report false for SupportsFeature("host_memory_import").
+     * 
+     * @param host_pointer Host allocation to wrap
+     * @param size Size in bytes
+     * @param type Buffer type
+     * @return Buffer aliasing the host memory, or error if the device cannot address it
+     */
+    virtual Result<std::shared_ptr<IBuffer>> WrapHostMemory(void* host_pointer, size_t size,
+                                                            IBuffer::Type type = IBuffer::Type::STORAGE) = 0;
+    
     // Utility functions
     
     /**
@@ -358,7 +576,10 @@ public:
      * 
      * This method provides a unified interface for setting SLANG-generated
      * global parameters across different backends (CUDA constant memory,
-     * Vulkan descriptor sets, etc.)
+     * Vulkan push constants, etc.). Buffer pointers are packed as 64-bit
+     * IBuffer::GetDeviceAddress() values; on Vulkan this needs the
+     * "buffer_device_address" feature. Descriptor-bound Vulkan kernels without
+     * push constants ignore the call and take buffers through SetBuffer().
      * 
      * @param params Pointer to parameter data buffer
      * @param size Size of parameter data in bytes
@@ -0,0 +1,566 @@
+#include "spirv_reflection.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
+namespace kerntopia {
+
+namespace {
+
+// SPIR-V constants used by the reflector (see the SPIR-V specification, section 3)
+constexpr uint32_t kSpirvMagic = 0x07230203;
+constexpr uint32_t kHeaderWords = 5;
+
+constexpr uint32_t OpName = 5;
+constexpr uint32_t OpCapability = 17;
+constexpr uint32_t OpEntryPoint = 15;
+constexpr uint32_t OpExecutionMode = 16;
+constexpr uint32_t OpTypeBool = 20;
+constexpr uint32_t OpTypeInt = 21;
+constexpr uint32_t OpTypeFloat = 22;
+constexpr uint32_t OpTypeVector = 23;
+constexpr uint32_t OpTypeMatrix = 24;
+constexpr uint32_t OpTypeImage = 25;
+constexpr uint32_t OpTypeSampler = 26;
+constexpr uint32_t OpTypeSampledImage = 27;
+constexpr uint32_t OpTypeArray = 28;
+constexpr uint32_t OpTypeRuntimeArray = 29;
+constexpr uint32_t OpTypeStruct = 30;
+constexpr uint32_t OpTypePointer = 32;
+constexpr uint32_t OpConstant = 43;
+constexpr uint32_t OpConstantComposite = 44;
+constexpr uint32_t OpSpecConstantTrue = 48;
+constexpr uint32_t OpSpecConstantFalse = 49;
+constexpr uint32_t OpSpecConstant = 50;
+constexpr uint32_t OpSpecConstantComposite = 51;
+constexpr uint32_t OpVariable = 59;
+constexpr uint32_t OpDecorate = 71;
+constexpr uint32_t OpMemberDecorate = 72;
+constexpr uint32_t OpExecutionModeId = 331;
+
+constexpr uint32_t ExecutionModelGLCompute = 5;
+constexpr uint32_t ExecutionModeLocalSize = 17;
+constexpr uint32_t ExecutionModeLocalSizeId = 38;
+
+constexpr uint32_t DecorationSpecId = 1;
+constexpr uint32_t DecorationBlock = 2;
+constexpr uint32_t DecorationBufferBlock = 3;
+constexpr uint32_t DecorationArrayStride = 6;
+constexpr uint32_t DecorationMatrixStride = 7;
+constexpr uint32_t DecorationBuiltIn = 11;
+constexpr uint32_t DecorationBinding = 33;
+constexpr uint32_t DecorationDescriptorSet = 34;
+constexpr uint32_t DecorationOffset = 35;
+constexpr uint32_t BuiltInWorkgroupSize = 25;
+
+constexpr uint32_t StorageClassUniformConstant = 0;
+constexpr uint32_t StorageClassUniform = 2;
+constexpr uint32_t StorageClassPushConstant = 9;
+constexpr uint32_t StorageClassStorageBuffer = 12;
+
+constexpr uint32_t DimBuffer = 5;
+
+constexpr uint32_t CapabilityPhysicalStorageBufferAddresses = 5347;
+constexpr uint32_t StorageClassPhysicalStorageBuffer = 5349;
+
+struct TypeInfo {
+    uint32_t opcode = 0;
+    std::vector<uint32_t> operands;     // Words after the result id
+};
+
+struct DecorationInfo {
+    bool has_binding = false;
+    bool has_set = false;
+    bool block = false;
+    bool buffer_block = false;
+    bool workgroup_size = false;
+    bool has_spec_id = false;
+    uint32_t binding = 0;
+    uint32_t set = 0;
+    uint32_t array_stride = 0;
+    uint32_t spec_id = 0;
+};
+
+struct SpecConstantInfo {
+    uint32_t type = 0;
+    uint32_t value = 0;
+};
+
+struct MemberInfo {
+    uint32_t offset = 0;
+    uint32_t matrix_stride = 0;
+};
+
+struct VariableInfo {
+    uint32_t id = 0;
+    uint32_t pointer_type = 0;
+    uint32_t storage_class = 0;
+};
+
+// Decode a null-terminated literal string starting at words[0]; returns words consumed
+uint32_t ReadString(const uint32_t* words, uint32_t max_words, std::string& out) {
+    out.clear();
+    for (uint32_t i = 0; i < max_words; ++i) {
+        for (uint32_t b = 0; b < 4; ++b) {
+            char c = static_cast<char>((words[i] >> (b * 8)) & 0xFF);
+            if (c == '\0') {
+                return i + 1;
+            }
+            out.push_back(c);
+        }
+    }
+    return max_words;
+}
+
+class SpirvParser {
+public:
+    std::unordered_map<uint32_t, TypeInfo> types;
+    std::unordered_map<uint32_t, uint32_t> constants;          // Scalar OpConstant/OpSpecConstant values
+    std::unordered_map<uint32_t, std::vector<uint32_t>> composites; // Constant composite constituents
+    std::unordered_map<uint32_t, SpecConstantInfo> spec_constants;  // Scalar OpSpecConstant* by result id
+    std::unordered_map<uint32_t, DecorationInfo> decorations;
+    std::unordered_map<uint32_t, std::unordered_map<uint32_t, MemberInfo>> members;
+    std::unordered_map<uint32_t, std::string> names;
+    std::vector<VariableInfo> variables;
+
+    // Entry point state
+    uint32_t entry_id = 0;
+    bool entry_found = false;
+
+    // Size in bytes of a type laid out with explicit offsets/strides (for push constants)
+    uint32_t TypeSize(uint32_t type_id, uint32_t matrix_stride = 0) const {
+        auto it = types.find(type_id);
+        if (it == types.end()) {
+            return 0;
+        }
+        const TypeInfo& type = it->second;
+        switch (type.opcode) {
+            case OpTypeInt:
+            case OpTypeFloat:
+                return type.operands.empty() ? 0 : type.operands[0] / 8;
+            case OpTypeVector:
+                return type.operands.size() < 2 ? 0 : TypeSize(type.operands[0]) * type.operands[1];
+            case OpTypeMatrix: {
+                if (type.operands.size() < 2) return 0;
+                uint32_t column_size = matrix_stride ? matrix_stride : TypeSize(type.operands[0]);
+                return column_size * type.operands[1];
+            }
+            case OpTypeArray: {
+                if (type.operands.size() < 2) return 0;
+                uint32_t length = ConstantValue(type.operands[1]);
+                auto decoration = decorations.find(type_id);
+                uint32_t stride = (decoration != decorations.end() && decoration->second.array_stride)
+                                      ? decoration->second.array_stride
+                                      : TypeSize(type.operands[0], matrix_stride);
+                return stride * length;
+            }
+            case OpTypeStruct: {
+                uint32_t size = 0;
+                auto member_it = members.find(type_id);
+                for (uint32_t i = 0; i < type.operands.size(); ++i) {
+                    MemberInfo member;
+                    if (member_it != members.end()) {
+                        auto m = member_it->second.find(i);
+                        if (m != member_it->second.end()) member = m->second;
+                    }
+                    size = std::max(size, member.offset + TypeSize(type.operands[i], member.matrix_stride));
+                }
+                return size;
+            }
+            case OpTypePointer:
+                // Buffer device addresses are 64-bit; other pointers cannot appear in explicitly laid out blocks
+                return (!type.operands.empty() && type.operands[0] == StorageClassPhysicalStorageBuffer) ? 8 : 0;
+            default:
+                return 0;
+        }
+    }
+
+    uint32_t ConstantValue(uint32_t id) const {
+        auto it = constants.find(id);
+        return it != constants.end() ? it->second : 0;
+    }
+
+    // constant_id of a specialization constant, or -1 for ordinary constants
+    int32_t SpecId(uint32_t id) const {
+        auto it = decorations.find(id);
+        if (it == decorations.end() || !it->second.has_spec_id || spec_constants.count(id) == 0) {
+            return -1;
+        }
+        return static_cast<int32_t>(it->second.spec_id);
+    }
+};
+
+// Locate the GLCompute entry point named entry_point; returns its function id or 0
+uint32_t FindEntryPointId(const std::vector<uint32_t>& words, const std::string& entry_point) {
+    for (size_t pos = kHeaderWords; pos < words.size();) {
+        uint32_t opcode = words[pos] & 0xFFFF;
+        uint32_t word_count = words[pos] >> 16;
+        if (word_count == 0 || pos + word_count > words.size()) {
+            return 0;
+        }
+        if (opcode == OpEntryPoint && word_count >= 4 && words[pos + 1] == ExecutionModelGLCompute) {
+            std::string name;
+            ReadString(&words[pos + 3], word_count - 3, name);
+            if (name == entry_point) {
+                return words[pos + 2];
+            }
+        }
+        pos += word_count;
+    }
+    return 0;
+}
+
+} // namespace
+
+const SpirvDescriptorBinding* SpirvReflection::FindBinding(uint32_t binding, uint32_t set) const {
+    for (const auto& entry : bindings) {
+        if (entry.set == set && entry.binding == binding) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+const SpirvSpecConstant* SpirvReflection::FindSpecConstant(uint32_t constant_id) const {
+    for (const auto& constant : spec_constants) {
+        if (constant.constant_id == constant_id) {
+            return &constant;
+        }
+    }
+    return nullptr;
+}
+
+std::string SpirvReflection::GetLayoutSignature() const {
+    std::ostringstream signature;
+    for (const auto& entry : bindings) {
+        signature << entry.set << "." << entry.binding << ":" << static_cast<uint32_t>(entry.type)
+                  << "x" << entry.count << ";";
+    }
+    signature << "pc" << push_constant_size;
+    return signature.str();
+}
+
+Result<SpirvReflection> ReflectSpirv(const std::vector<uint8_t>& bytecode, const std::string& entry_point) {
+    if (bytecode.size() < kHeaderWords * 4 || bytecode.size() % 4 != 0) {
+        return KERNTOPIA_RESULT_ERROR(SpirvReflection, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                     "SPIR-V module too small or not word aligned");
+    }
+
+    std::vector<uint32_t> words(bytecode.size() / 4);
+    std::memcpy(words.data(), bytecode.data(), bytecode.size());
+    if (words[0] != kSpirvMagic) {
+        return KERNTOPIA_RESULT_ERROR(SpirvReflection, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                     "Invalid SPIR-V magic number");
+    }
+
+    SpirvParser parser;
+
+    // First pass: collect everything; resolution happens once all ids are known
+    std::vector<std::vector<uint32_t>> execution_modes;
+    bool uses_device_addresses = false;
+    for (size_t pos = kHeaderWords; pos < words.size();) {
+        uint32_t opcode = words[pos] & 0xFFFF;
+        uint32_t word_count = words[pos] >> 16;
+        if (word_count == 0 || pos + word_count > words.size()) {
+            return KERNTOPIA_RESULT_ERROR(SpirvReflection, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                         "Malformed SPIR-V instruction at word " + std::to_string(pos));
+        }
+        const uint32_t* op = &words[pos + 1];
+        uint32_t operand_count = word_count - 1;
+
+        switch (opcode) {
+            case OpCapability:
+                if (operand_count >= 1 && op[0] == CapabilityPhysicalStorageBufferAddresses) {
+                    uses_device_addresses = true;
+                }
+                break;
+            case OpName:
+                if (operand_count >= 2) {
+                    ReadString(op + 1, operand_count - 1, parser.names[op[0]]);
+                }
+                break;
+            case OpEntryPoint:
+                if (operand_count >= 3 && op[0] == ExecutionModelGLCompute && !parser.entry_found) {
+                    std::string name;
+                    ReadString(op + 2, operand_count - 2, name);
+                    if (name == entry_point) {
+                        parser.entry_id = op[1];
+                        parser.entry_found = true;
+                    }
+                }
+                break;
+            case OpExecutionMode:
+            case OpExecutionModeId:
+                if (operand_count >= 2) {
+                    execution_modes.emplace_back(op, op + operand_count);
+                }
+                break;
+            case OpTypeBool:
+            case OpTypeInt:
+            case OpTypeFloat:
+            case OpTypeVector:
+            case OpTypeMatrix:
+            case OpTypeImage:
+            case OpTypeSampler:
+            case OpTypeSampledImage:
+            case OpTypeArray:
+            case OpTypeRuntimeArray:
+            case OpTypeStruct:
+            case OpTypePointer:
+                if (operand_count >= 1) {
+                    TypeInfo& type = parser.types[op[0]];
+                    type.opcode = opcode;
+                    type.operands.assign(op + 1, op + operand_count);
+                }
+                break;
+            case OpConstant:
+            case OpSpecConstant:
+                // Operands: result type, result id, value (low word is enough for sizes and counts)
+                if (operand_count >= 3) {
+                    parser.constants[op[1]] = op[2];
+                    if (opcode == OpSpecConstant) {
+                        parser.spec_constants[op[1]] = {op[0], op[2]};
+                    }
+                }
+                break;
+            case OpSpecConstantTrue:
+            case OpSpecConstantFalse:
+                if (operand_count >= 2) {
+                    uint32_t value = opcode == OpSpecConstantTrue ? 1 : 0;
+                    parser.constants[op[1]] = value;
+                    parser.spec_constants[op[1]] = {op[0], value};
+                }
+                break;
+            case OpConstantComposite:
+            case OpSpecConstantComposite:
+                if (operand_count >= 2) {
+                    parser.composites[op[1]].assign(op + 2, op + operand_count);
+                }
+                break;
+            case OpDecorate:
+                if (operand_count >= 2) {
+                    DecorationInfo& decoration = parser.decorations[op[0]];
+                    uint32_t value = operand_count >= 3 ? op[2] : 0;
+                    switch (op[1]) {
+                        case DecorationBinding: decoration.has_binding = true; decoration.binding = value; break;
+                        case DecorationDescriptorSet: decoration.has_set = true; decoration.set = value; break;
+                        case DecorationBlock: decoration.block = true; break;
+                        case DecorationBufferBlock: decoration.buffer_block = true; break;
+                        case DecorationArrayStride: decoration.array_stride = value; break;
+                        case DecorationBuiltIn: decoration.workgroup_size = (value == BuiltInWorkgroupSize); break;
+                        case DecorationSpecId: decoration.has_spec_id = true; decoration.spec_id = value; break;
+                        default: break;
+                    }
+                }
+                break;
+            case OpMemberDecorate:
+                if (operand_count >= 4) {
+                    MemberInfo& member = parser.members[op[0]][op[1]];
+                    if (op[2] == DecorationOffset) member.offset = op[3];
+                    if (op[2] == DecorationMatrixStride) member.matrix_stride = op[3];
+                }
+                break;
+            case OpVariable:
+                if (operand_count >= 3) {
+                    parser.variables.push_back({op[1], op[0], op[2]});
+                }
+                break;
+            default:
+                break;
+        }
+        pos += word_count;
+    }
+
+    if (!parser.entry_found) {
+        return KERNTOPIA_RESULT_ERROR(SpirvReflection, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                     "SPIR-V module has no GLCompute entry point named '" + entry_point + "'");
+    }
+
+    SpirvReflection reflection;
+    reflection.entry_point = entry_point;
+    reflection.uses_device_addresses = uses_device_addresses;
+
+    // Workgroup size: LocalSize literals, LocalSizeId constants, overridden by a WorkgroupSize builtin
+    for (const auto& operands : execution_modes) {
+        if (operands[0] != parser.entry_id || operands.size() < 5) {
+            continue;
+        }
+        if (operands[1] == ExecutionModeLocalSize) {
+            for (int i = 0; i < 3; ++i) reflection.local_size[i] = operands[2 + i];
+            reflection.has_local_size = true;
+        } else if (operands[1] == ExecutionModeLocalSizeId) {
+            for (int i = 0; i < 3; ++i) {
+                reflection.local_size[i] = parser.ConstantValue(operands[2 + i]);
+                reflection.local_size_spec_ids[i] = parser.SpecId(operands[2 + i]);
+            }
+            reflection.has_local_size = true;
+        }
+    }
+    for (const auto& [id, constituents] : parser.composites) {
+        auto decoration = parser.decorations.find(id);
+        if (decoration != parser.decorations.end() && decoration->second.workgroup_size && constituents.size() == 3) {
+            for (int i = 0; i < 3; ++i) {
+                reflection.local_size[i] = parser.ConstantValue(constituents[i]);
+                reflection.local_size_spec_ids[i] = parser.SpecId(constituents[i]);
+            }
+            reflection.has_local_size = true;
+        }
+    }
+    for (uint32_t& size : reflection.local_size) {
+        size = std::max(1u, size);
+    }
+
+    // Specialization constants the pipeline can override through VkSpecializationInfo
+    for (const auto& [id, constant] : parser.spec_constants) {
+        int32_t constant_id = parser.SpecId(id);
+        if (constant_id < 0) {
+            continue;
+        }
+        SpirvSpecConstant spec;
+        spec.constant_id = static_cast<uint32_t>(constant_id);
+        spec.default_value = constant.value;
+        auto type_it = parser.types.find(constant.type);
+        if (type_it != parser.types.end() && type_it->second.opcode != OpTypeBool && !type_it->second.operands.empty()) {
+            spec.size = std::max(4u, type_it->second.operands[0] / 8);
+        }
+        auto name_it = parser.names.find(id);
+        if (name_it != parser.names.end()) {
+            spec.name = name_it->second;
+        }
+        reflection.spec_constants.push_back(spec);
+    }
+    std::sort(reflection.spec_constants.begin(), reflection.spec_constants.end(),
+              [](const SpirvSpecConstant& a, const SpirvSpecConstant& b) { return a.constant_id < b.constant_id; });
+
+    // Resources: every module-scope variable with a descriptor decoration, plus the push-constant block
+    for (const VariableInfo& variable : parser.variables) {
+        auto pointer_it = parser.types.find(variable.pointer_type);
+        if (pointer_it == parser.types.end() || pointer_it->second.opcode != OpTypePointer ||
+            pointer_it->second.operands.size() < 2) {
+            continue;
+        }
+        uint32_t pointee = pointer_it->second.operands[1];
+
+        if (variable.storage_class == StorageClassPushConstant) {
+            reflection.push_constant_size = std::max(reflection.push_constant_size, parser.TypeSize(pointee));
+            continue;
+        }
+        if (variable.storage_class != StorageClassUniform &&
+            variable.storage_class != StorageClassUniformConstant &&
+            variable.storage_class != StorageClassStorageBuffer) {
+            continue;
+        }
+
+        auto decoration_it = parser.decorations.find(variable.id);
+        if (decoration_it == parser.decorations.end() || !decoration_it->second.has_binding) {
+            continue;
+        }
+
+        SpirvDescriptorBinding binding;
+        binding.set = decoration_it->second.set;
+        binding.binding = decoration_it->second.binding;
+        auto name_it = parser.names.find(variable.id);
+        if (name_it != parser.names.end()) {
+            binding.name = name_it->second;
+        }
+
+        // Peel descriptor arrays
+        uint32_t type_id = pointee;
+        auto type_it = parser.types.find(type_id);
+        while (type_it != parser.types.end() &&
+               (type_it->second.opcode == OpTypeArray || type_it->second.opcode == OpTypeRuntimeArray)) {
+            if (type_it->second.opcode == OpTypeArray && type_it->second.operands.size() >= 2) {
+                binding.count *= std::max(1u, parser.ConstantValue(type_it->second.operands[1]));
+            }
+            type_id = type_it->second.operands.empty() ? 0 : type_it->second.operands[0];
+            type_it = parser.types.find(type_id);
+        }
+        if (type_it == parser.types.end()) {
+            continue;
+        }
+
+        const TypeInfo& type = type_it->second;
+        auto type_decoration = parser.decorations.find(type_id);
+        bool buffer_block = type_decoration != parser.decorations.end() && type_decoration->second.buffer_block;
+
+        if (variable.storage_class == StorageClassStorageBuffer) {
+            binding.type = SpirvDescriptorType::STORAGE_BUFFER;
+        } else if (variable.storage_class == StorageClassUniform) {
+            binding.type = buffer_block ? SpirvDescriptorType::STORAGE_BUFFER : SpirvDescriptorType::UNIFORM_BUFFER;
+        } else if (type.opcode == OpTypeSampler) {
+            binding.type = SpirvDescriptorType::SAMPLER;
+        } else if (type.opcode == OpTypeSampledImage) {
+            binding.type = SpirvDescriptorType::COMBINED_IMAGE_SAMPLER;
+        } else if (type.opcode == OpTypeImage && type.operands.size() >= 6) {
+            // Operands: sampled type, dim, depth, arrayed, MS, sampled (1 = sampled, 2 = storage)
+            bool storage = type.operands[5] == 2;
+            if (type.operands[1] == DimBuffer) {
+                binding.type = storage ? SpirvDescriptorType::STORAGE_TEXEL_BUFFER : SpirvDescriptorType::UNIFORM_TEXEL_BUFFER;
+            } else {
+                binding.type = storage ? SpirvDescriptorType::STORAGE_IMAGE : SpirvDescriptorType::SAMPLED_IMAGE;
+            }
+        } else {
+            continue;
+        }
+
+        reflection.bindings.push_back(binding);
+    }
+
+    std::sort(reflection.bindings.begin(), reflection.bindings.end(),
+              [](const SpirvDescriptorBinding& a, const SpirvDescriptorBinding& b) {
+                  return a.set != b.set ? a.set < b.set : a.binding < b.binding;
+              });
+
+    return Result<SpirvReflection>::Success(reflection);
+}
+
+Result<std::vector<uint8_t>> PatchSpirvLocalSize(const std::vector<uint8_t>& bytecode, const std::string& entry_point,
+                                                 const uint32_t local_size[3]) {
+    if (bytecode.size() < kHeaderWords * 4 || bytecode.size() % 4 != 0) {
+        return KERNTOPIA_RESULT_ERROR(std::vector<uint8_t>, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                     "SPIR-V module too small or not word aligned");
+    }
+
+    std::vector<uint32_t> words(bytecode.size() / 4);
+    std::memcpy(words.data(), bytecode.data(), bytecode.size());
+    uint32_t entry_id = words[0] == kSpirvMagic ? FindEntryPointId(words, entry_point) : 0;
+    if (entry_id == 0) {
+        return KERNTOPIA_RESULT_ERROR(std::vector<uint8_t>, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                     "SPIR-V module has no GLCompute entry point named '" + entry_point + "'");
+    }
+
+    size_t local_size_pos = 0;
+    for (size_t pos = kHeaderWords; pos < words.size();) {
+        uint32_t opcode = words[pos] & 0xFFFF;
+        uint32_t word_count = words[pos] >> 16;
+        if (word_count == 0 || pos + word_count > words.size()) {
+            return KERNTOPIA_RESULT_ERROR(std::vector<uint8_t>, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                         "Malformed SPIR-V instruction at word " + std::to_string(pos));
+        }
+        if (opcode == OpExecutionMode && word_count == 6 && words[pos + 1] == entry_id &&
+            words[pos + 2] == ExecutionModeLocalSize) {
+            local_size_pos = pos + 3;
+        }
+        if (opcode == OpDecorate && word_count >= 4 && words[pos + 2] == DecorationBuiltIn &&
+            words[pos + 3] == BuiltInWorkgroupSize) {
+            return KERNTOPIA_RESULT_ERROR(std::vector<uint8_t>, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                         "Workgroup size comes from a WorkgroupSize builtin and cannot be patched");
+        }
+        pos += word_count;
+    }
+    if (local_size_pos == 0) {
+        return KERNTOPIA_RESULT_ERROR(std::vector<uint8_t>, ErrorCategory::VALIDATION, ErrorCode::KERNEL_LOAD_FAILED,
+                                     "Entry point '" + entry_point + "' has no literal LocalSize to patch");
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        words[local_size_pos + i] = local_size[i];
+    }
+    std::vector<uint8_t> patched(bytecode.size());
+    std::memcpy(patched.data(), words.data(), patched.size());
+    return Result<std::vector<uint8_t>>::Success(std::move(patched));
+}
+
+} // namespace kerntopia
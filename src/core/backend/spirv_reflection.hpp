@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../common/error_handling.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace kerntopia {
+
+/**
+ * @brief Descriptor kinds found in SPIR-V resource declarations
+ *
+ * Values match VkDescriptorType so the Vulkan backend can cast directly
+ * without this header depending on vulkan.h.
+ */
+enum class SpirvDescriptorType : uint32_t {
+    SAMPLER = 0,
+    COMBINED_IMAGE_SAMPLER = 1,
+    SAMPLED_IMAGE = 2,
+    STORAGE_IMAGE = 3,
+    UNIFORM_TEXEL_BUFFER = 4,
+    STORAGE_TEXEL_BUFFER = 5,
+    UNIFORM_BUFFER = 6,
+    STORAGE_BUFFER = 7
+};
+
+/**
+ * @brief One descriptor binding declared by a shader module
+ */
+struct SpirvDescriptorBinding {
+    uint32_t set = 0;                                       ///< DescriptorSet decoration
+    uint32_t binding = 0;                                   ///< Binding decoration
+    SpirvDescriptorType type = SpirvDescriptorType::STORAGE_BUFFER; ///< Descriptor kind
+    uint32_t count = 1;                                     ///< Array size (1 for non-arrays)
+    std::string name;                                       ///< Variable name from OpName, if present
+};
+
+/**
+ * @brief Scalar specialization constant (OpSpecConstant*) decorated with a SpecId
+ */
+struct SpirvSpecConstant {
+    uint32_t constant_id = 0;                               ///< SpecId decoration (constant_id in the shader)
+    uint32_t default_value = 0;                             ///< Low word of the default value (booleans are 0 or 1)
+    uint32_t size = 4;                                      ///< Bytes of the scalar type (booleans are 4-byte VkBool32)
+    std::string name;                                       ///< Constant name from OpName, if present
+};
+
+/**
+ * @brief Resource interface of a compute entry point extracted from SPIR-V
+ */
+struct SpirvReflection {
+    std::string entry_point;                        ///< Reflected entry point name
+    uint32_t local_size[3] = {1, 1, 1};             ///< Workgroup size from LocalSize/LocalSizeId/WorkgroupSize
+    bool has_local_size = false;                    ///< True if the module declared a workgroup size
+    int32_t local_size_spec_ids[3] = {-1, -1, -1};  ///< constant_id driving each workgroup dimension, -1 if fixed
+    std::vector<SpirvSpecConstant> spec_constants;  ///< Specialization constants sorted by constant_id
+    std::vector<SpirvDescriptorBinding> bindings;   ///< Descriptor bindings sorted by (set, binding)
+    uint32_t push_constant_size = 0;                ///< Bytes of the push-constant block (0 if none)
+    bool uses_device_addresses = false;             ///< Declares PhysicalStorageBufferAddresses (buffer pointers)
+
+    /**
+     * @brief Find a binding in descriptor set 0
+     *
+     * @param binding Binding index
+     * @return Pointer to the binding or nullptr if the shader does not declare it
+     */
+    const SpirvDescriptorBinding* FindBinding(uint32_t binding, uint32_t set = 0) const;
+
+    /**
+     * @brief Find a specialization constant by constant_id
+     *
+     * @param constant_id SpecId of the constant
+     * @return Pointer to the constant or nullptr if the module does not declare it
+     */
+    const SpirvSpecConstant* FindSpecConstant(uint32_t constant_id) const;
+
+    /**
+     * @brief Canonical description of the layout (bindings and push constants)
+     *
+     * Kernels with equal signatures can share descriptor set and pipeline layouts.
+     */
+    std::string GetLayoutSignature() const;
+};
+
+/**
+ * @brief Parse a SPIR-V module and reflect the interface of one compute entry point
+ *
+ * Handles the subset of SPIR-V emitted for compute kernels: descriptor-bound
+ * buffers, images and samplers, one push-constant block (which may hold 64-bit
+ * buffer device addresses), and workgroup size via LocalSize, LocalSizeId or
+ * the WorkgroupSize builtin.
+ *
+ * @param bytecode SPIR-V binary (little-endian words)
+ * @param entry_point Entry point name to reflect
+ * @return Reflection data or error if the module is malformed or the entry point is missing
+ */
+Result<SpirvReflection> ReflectSpirv(const std::vector<uint8_t>& bytecode, const std::string& entry_point);
+
+/**
+ * @brief Rewrite the literal LocalSize execution mode of one entry point
+ *
+ * Specialization constants cannot change a workgroup size declared with literal
+ * LocalSize, so kernels compiled that way are resized by patching the module.
+ * Fails if the entry point has no LocalSize mode or the module declares a
+ * WorkgroupSize builtin, which would take precedence over the patched mode.
+ *
+ * @param bytecode SPIR-V binary (little-endian words)
+ * @param entry_point Entry point whose LocalSize is rewritten
+ * @param local_size New workgroup size
+ * @return Patched copy of the module
+ */
+Result<std::vector<uint8_t>> PatchSpirvLocalSize(const std::vector<uint8_t>& bytecode, const std::string& entry_point,
+                                                 const uint32_t local_size[3]);
+
+} // namespace kerntopia
@@ -2,6 +2,8 @@
 #include "../common/logger.hpp"
 #include "../common/error_handling.hpp"
 #include <cstring>
+#include <chrono>
+#include <algorithm>
 
 // Vulkan headers conditionally included
 #ifdef KERNTOPIA_VULKAN_SDK_AVAILABLE
@@ -10,16 +12,6 @@
 
 namespace kerntopia {
 
-// Vulkan internal structures (replicated from vulkan_runner.cpp)
-struct VulkanDevice {
-    VkPhysicalDevice physical_device = VK_NULL_HANDLE;
-    VkDevice logical_device = VK_NULL_HANDLE;
-    uint32_t compute_queue_family = 0;
-    VkQueue compute_queue = VK_NULL_HANDLE;
-    std::string device_name;
-    DeviceInfo device_info;
-};
-
 // Helper to convert Vulkan error to string
 std::string VulkanResultString(VkResult result) {
     switch (result) {
@@ -47,20 +39,972 @@ std::string VulkanResultString(VkResult result) {
     }
 }
 
-// Helper function to find memory type for buffer allocation
-uint32_t FindMemoryType(VkPhysicalDevice physical_device, uint32_t type_filter, VkMemoryPropertyFlags properties) {
-    VkPhysicalDeviceMemoryProperties mem_properties;
-    vkGetPhysicalDeviceMemoryProperties(physical_device, &mem_properties);
-    
-    for (uint32_t i = 0; i < mem_properties.memoryTypeCount; i++) {
-        if ((type_filter & (1 << i)) && 
-            (mem_properties.memoryTypes[i].propertyFlags & properties) == properties) {
-            return i;
-        }
+// Helper function to find memory type for buffer allocation
+uint32_t FindMemoryType(VkPhysicalDevice physical_device, uint32_t type_filter, VkMemoryPropertyFlags properties) {
+    VkPhysicalDeviceMemoryProperties mem_properties;
+    vkGetPhysicalDeviceMemoryProperties(physical_device, &mem_properties);
+    
+    for (uint32_t i = 0; i < mem_properties.memoryTypeCount; i++) {
+        if ((type_filter & (1 << i)) && 
+            (mem_properties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    
+    // Return 0 as fallback - caller should check if allocation succeeds
+    return 0;
+}
+
+// Like FindMemoryType, but reports whether a matching type exists instead of falling back to 0
+static bool TryFindMemoryType(VkPhysicalDevice physical_device, uint32_t type_filter,
+                              VkMemoryPropertyFlags properties, uint32_t& type_index) {
+    VkPhysicalDeviceMemoryProperties mem_properties;
+    vkGetPhysicalDeviceMemoryProperties(physical_device, &mem_properties);
+    
+    for (uint32_t i = 0; i < mem_properties.memoryTypeCount; i++) {
+        if ((type_filter & (1 << i)) && 
+            (mem_properties.memoryTypes[i].propertyFlags & properties) == properties) {
+            type_index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Buffers touched by both queue families are shared concurrently instead of transferring ownership
+static void SetBufferSharing(VkBufferCreateInfo& buffer_info, const VulkanDevice* device, uint32_t (&families)[2]) {
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (device->HasTransferQueue()) {
+        families[0] = device->compute_queue_family;
+        families[1] = device->transfer_queue_family;
+        buffer_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+        buffer_info.queueFamilyIndexCount = 2;
+        buffer_info.pQueueFamilyIndices = families;
+    }
+}
+
+uint64_t VulkanDevice::AttachCompletionSignal(VkSubmitInfo& submit, VulkanTimelineSignal& signal) const {
+    uint64_t token = completion_token + 1;
+    if (completion_timeline == VK_NULL_HANDLE) {
+        return token;
+    }
+    
+    // Binary semaphores in the same batch take a value slot that the driver ignores
+    uint32_t count = 0;
+    if (submit.signalSemaphoreCount > 0) {
+        signal.semaphores[count++] = submit.pSignalSemaphores[0];
+    }
+    signal.semaphores[count] = completion_timeline;
+    signal.values[count++] = token;
+    
+    signal.info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    signal.info.signalSemaphoreValueCount = count;
+    signal.info.pSignalSemaphoreValues = signal.values;
+    submit.pNext = &signal.info;
+    submit.signalSemaphoreCount = count;
+    submit.pSignalSemaphores = signal.semaphores;
+    return token;
+}
+
+Result<void> VulkanDevice::AwaitIssuedWork() const {
+    if (!await_token || completion_token == 0) {
+        return KERNTOPIA_VOID_SUCCESS();
+    }
+    auto await_result = await_token(completion_token);
+    if (!await_result) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     await_result.GetError().message);
+    }
+    if (!await_result.GetValue()) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     "Timed out waiting for device work before accessing mapped memory");
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+// VulkanStagingRing implementation
+Result<void> VulkanStagingRing::Initialize() {
+    if (!device_ || !device_->logical_device) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_NOT_AVAILABLE,
+                                     "Vulkan device not initialized");
+    }
+    
+    VkDevice device = device_->logical_device;
+    
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = kSegmentSize * kSegmentCount;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    uint32_t queue_families[2];
+    SetBufferSharing(buffer_info, device_, queue_families);
+    
+    VkResult result = vkCreateBuffer(device, &buffer_info, nullptr, &buffer_);
+    if (result != VK_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BUFFER_CREATION_FAILED,
+                                     "Failed to create staging buffer: " + VulkanResultString(result));
+    }
+    
+    VkMemoryRequirements mem_requirements;
+    vkGetBufferMemoryRequirements(device, buffer_, &mem_requirements);
+    
+    // Prefer cached memory so readbacks are not uncached host reads
+    uint32_t memory_type_index = 0;
+    if (!TryFindMemoryType(device_->physical_device, mem_requirements.memoryTypeBits,
+                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+                           VK_MEMORY_PROPERTY_HOST_CACHED_BIT, memory_type_index) &&
+        !TryFindMemoryType(device_->physical_device, mem_requirements.memoryTypeBits,
+                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                           memory_type_index)) {
+        Destroy();
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                     "No host-visible coherent memory type for staging buffer");
+    }
+    
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_requirements.size;
+    alloc_info.memoryTypeIndex = memory_type_index;
+    
+    result = vkAllocateMemory(device, &alloc_info, nullptr, &memory_);
+    if (result == VK_SUCCESS) {
+        result = vkBindBufferMemory(device, buffer_, memory_, 0);
+    }
+    if (result == VK_SUCCESS) {
+        void* mapped = nullptr;
+        result = vkMapMemory(device, memory_, 0, buffer_info.size, 0, &mapped);
+        mapped_ = static_cast<uint8_t*>(mapped);
+    }
+    if (result != VK_SUCCESS) {
+        Destroy();
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                     "Failed to allocate staging memory: " + VulkanResultString(result));
+    }
+    
+    VkCommandPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex = device_->compute_queue_family;
+    
+    result = vkCreateCommandPool(device, &pool_info, nullptr, &command_pool_);
+    if (result != VK_SUCCESS) {
+        Destroy();
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_INIT_FAILED,
+                                     "Failed to create staging command pool: " + VulkanResultString(result));
+    }
+    
+    if (device_->HasTransferQueue()) {
+        pool_info.queueFamilyIndex = device_->transfer_queue_family;
+        result = vkCreateCommandPool(device, &pool_info, nullptr, &transfer_pool_);
+        if (result != VK_SUCCESS) {
+            Destroy();
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_INIT_FAILED,
+                                         "Failed to create transfer command pool: " + VulkanResultString(result));
+        }
+    }
+    
+    for (Segment& segment : segments_) {
+        VkCommandBufferAllocateInfo cmd_info = {};
+        cmd_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        cmd_info.commandPool = command_pool_;
+        cmd_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        cmd_info.commandBufferCount = 1;
+        
+        VkFenceCreateInfo fence_info = {};
+        fence_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        
+        result = vkAllocateCommandBuffers(device, &cmd_info, &segment.compute_commands);
+        segment.transfer_commands = segment.compute_commands;
+        if (result == VK_SUCCESS && transfer_pool_ != VK_NULL_HANDLE) {
+            cmd_info.commandPool = transfer_pool_;
+            result = vkAllocateCommandBuffers(device, &cmd_info, &segment.transfer_commands);
+        }
+        if (result == VK_SUCCESS) {
+            result = vkCreateFence(device, &fence_info, nullptr, &segment.fence);
+        }
+        if (result != VK_SUCCESS) {
+            Destroy();
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_INIT_FAILED,
+                                         "Failed to create staging segment: " + VulkanResultString(result));
+        }
+    }
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Vulkan staging ring created: " + std::to_string(kSegmentCount) +
+                       " x " + std::to_string(kSegmentSize / (1024 * 1024)) + " MB, memory_type=" +
+                       std::to_string(memory_type_index) + (transfer_pool_ != VK_NULL_HANDLE
+                           ? ", transfer queue family " + std::to_string(device_->transfer_queue_family) : ""));
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+void VulkanStagingRing::Destroy() {
+    if (!device_ || !device_->logical_device) {
+        return;
+    }
+    
+    VkDevice device = device_->logical_device;
+    
+    for (Segment& segment : segments_) {
+        if (segment.pending) {
+            vkWaitForFences(device, 1, &segment.fence, VK_TRUE, UINT64_MAX);
+            segment.pending = false;
+        }
+        if (segment.fence != VK_NULL_HANDLE) {
+            vkDestroyFence(device, segment.fence, nullptr);
+            segment.fence = VK_NULL_HANDLE;
+        }
+        segment.command_buffer = VK_NULL_HANDLE; // Freed with the command pools
+        segment.compute_commands = VK_NULL_HANDLE;
+        segment.transfer_commands = VK_NULL_HANDLE;
+    }
+    
+    if (command_pool_ != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(device, command_pool_, nullptr);
+        command_pool_ = VK_NULL_HANDLE;
+    }
+    if (transfer_pool_ != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(device, transfer_pool_, nullptr);
+        transfer_pool_ = VK_NULL_HANDLE;
+    }
+    if (mapped_) {
+        vkUnmapMemory(device, memory_);
+        mapped_ = nullptr;
+    }
+    if (buffer_ != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device, buffer_, nullptr);
+        buffer_ = VK_NULL_HANDLE;
+    }
+    if (memory_ != VK_NULL_HANDLE) {
+        vkFreeMemory(device, memory_, nullptr);
+        memory_ = VK_NULL_HANDLE;
+    }
+}
+
+// Rotates to the next segment, waits out its previous transfer and opens its command buffer
+// for the compute queue or, if requested, the transfer queue
+Result<VulkanStagingRing::Segment*> VulkanStagingRing::BeginSegment(uint32_t& index, bool transfer_queue) {
+    index = next_segment_;
+    Segment& segment = segments_[index];
+    next_segment_ = (next_segment_ + 1) % kSegmentCount;
+    
+    // Reusing a segment copies out any readback it was holding
+    auto retire_result = RetireSegment(segment);
+    if (!retire_result) {
+        return KERNTOPIA_RESULT_ERROR(Segment*, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     retire_result.GetError().message);
+    }
+    
+    segment.command_buffer = transfer_queue ? segment.transfer_commands : segment.compute_commands;
+    segment.queue = transfer_queue ? device_->transfer_queue : device_->compute_queue;
+    
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    VkResult result = vkBeginCommandBuffer(segment.command_buffer, &begin_info);
+    if (result != VK_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(Segment*, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     "Failed to begin staging command buffer: " + VulkanResultString(result));
+    }
+    return Result<Segment*>::Success(&segment);
+}
+
+Result<void> VulkanStagingRing::RetireSegment(Segment& segment) {
+    if (!segment.pending) {
+        return KERNTOPIA_VOID_SUCCESS();
+    }
+    
+    VkResult result = vkWaitForFences(device_->logical_device, 1, &segment.fence, VK_TRUE, UINT64_MAX);
+    if (result != VK_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     "Failed to wait for staging transfer: " + VulkanResultString(result));
+    }
+    vkResetFences(device_->logical_device, 1, &segment.fence);
+    segment.pending = false;
+    
+    // Readback data is ready in this segment's slice of the ring
+    if (segment.readback_dst) {
+        size_t index = static_cast<size_t>(&segment - segments_);
+        std::memcpy(segment.readback_dst, mapped_ + index * kSegmentSize, segment.readback_size);
+        segment.readback_dst = nullptr;
+        segment.readback_size = 0;
+    }
+    
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> VulkanStagingRing::SubmitSegment(Segment& segment, VkSemaphore signal) {
+    VkResult result = vkEndCommandBuffer(segment.command_buffer);
+    if (result != VK_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     "Failed to end staging command buffer: " + VulkanResultString(result));
+    }
+    
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &segment.command_buffer;
+    if (signal != VK_NULL_HANDLE) {
+        submit_info.signalSemaphoreCount = 1;
+        submit_info.pSignalSemaphores = &signal;
+    }
+    
+    // Copies on the compute queue complete a token like dispatches do
+    VulkanTimelineSignal timeline_signal;
+    uint64_t token = 0;
+    if (segment.queue == device_->compute_queue) {
+        token = device_->AttachCompletionSignal(submit_info, timeline_signal);
+    }
+    
+    result = vkQueueSubmit(segment.queue, 1, &submit_info, segment.fence);
+    if (result != VK_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     "Failed to submit staging transfer: " + VulkanResultString(result));
+    }
+    
+    if (token != 0) {
+        device_->completion_token = token;
+    }
+    segment.pending = true;
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> VulkanStagingRing::Drain() {
+    // Retire oldest first so readbacks land in submission order
+    for (uint32_t i = 0; i < kSegmentCount; ++i) {
+        auto result = RetireSegment(segments_[(next_segment_ + i) % kSegmentCount]);
+        if (!result) {
+            return result;
+        }
+    }
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> VulkanStagingRing::Upload(VkBuffer dst, const void* data, size_t size, size_t offset) {
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+    size_t copied = 0;
+    
+    while (copied < size) {
+        uint32_t index = 0;
+        auto segment_result = BeginSegment(index);
+        if (!segment_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         segment_result.GetError().message);
+        }
+        Segment& segment = *segment_result.GetValue();
+        
+        size_t chunk = std::min(static_cast<size_t>(kSegmentSize), size - copied);
+        std::memcpy(mapped_ + index * kSegmentSize, src + copied, chunk);
+        
+        VkBufferCopy region = {};
+        region.srcOffset = index * kSegmentSize;
+        region.dstOffset = offset + copied;
+        region.size = chunk;
+        vkCmdCopyBuffer(segment.command_buffer, buffer_, dst, 1, &region);
+        
+        // Make the copy visible to compute shaders in later submissions on this queue
+        VkBufferMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_UNIFORM_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = dst;
+        barrier.offset = region.dstOffset;
+        barrier.size = chunk;
+        vkCmdPipelineBarrier(segment.command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0, 0, nullptr, 1, &barrier, 0, nullptr);
+        
+        auto submit_result = SubmitSegment(segment);
+        if (!submit_result) {
+            return submit_result;
+        }
+        copied += chunk;
+    }
+    
+    return Drain();
+}
+
+Result<void> VulkanStagingRing::UploadAsync(VkBuffer dst, const void* data, size_t size, size_t offset, VkSemaphore signal) {
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+    size_t copied = 0;
+    
+    while (copied < size) {
+        uint32_t index = 0;
+        auto segment_result = BeginSegment(index, true);
+        if (!segment_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         segment_result.GetError().message);
+        }
+        Segment& segment = *segment_result.GetValue();
+        
+        size_t chunk = std::min(static_cast<size_t>(kSegmentSize), size - copied);
+        std::memcpy(mapped_ + index * kSegmentSize, src + copied, chunk);
+        
+        VkBufferCopy region = {};
+        region.srcOffset = index * kSegmentSize;
+        region.dstOffset = offset + copied;
+        region.size = chunk;
+        vkCmdCopyBuffer(segment.command_buffer, buffer_, dst, 1, &region);
+        
+        // A semaphore signal covers every earlier submission on the queue, so only the last chunk signals
+        copied += chunk;
+        auto submit_result = SubmitSegment(segment, copied == size ? signal : VK_NULL_HANDLE);
+        if (!submit_result) {
+            return submit_result;
+        }
+    }
+    
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> VulkanStagingRing::Download(VkBuffer src, void* data, size_t size, size_t offset) {
+    uint8_t* dst = static_cast<uint8_t*>(data);
+    size_t copied = 0;
+    
+    while (copied < size) {
+        uint32_t index = 0;
+        auto segment_result = BeginSegment(index);
+        if (!segment_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         segment_result.GetError().message);
+        }
+        Segment& segment = *segment_result.GetValue();
+        
+        size_t chunk = std::min(static_cast<size_t>(kSegmentSize), size - copied);
+        
+        // Wait for shader writes from earlier dispatches before reading the buffer
+        VkBufferMemoryBarrier barrier = {};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = src;
+        barrier.offset = offset + copied;
+        barrier.size = chunk;
+        vkCmdPipelineBarrier(segment.command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, nullptr, 1, &barrier, 0, nullptr);
+        
+        VkBufferCopy region = {};
+        region.srcOffset = offset + copied;
+        region.dstOffset = index * kSegmentSize;
+        region.size = chunk;
+        vkCmdCopyBuffer(segment.command_buffer, src, buffer_, 1, &region);
+        
+        // Make the staged bytes visible to host reads
+        VkBufferMemoryBarrier host_barrier = {};
+        host_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        host_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        host_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        host_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        host_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        host_barrier.buffer = buffer_;
+        host_barrier.offset = region.dstOffset;
+        host_barrier.size = chunk;
+        vkCmdPipelineBarrier(segment.command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                             0, 0, nullptr, 1, &host_barrier, 0, nullptr);
+        
+        auto submit_result = SubmitSegment(segment);
+        if (!submit_result) {
+            return submit_result;
+        }
+        segment.readback_dst = dst + copied;
+        segment.readback_size = chunk;
+        copied += chunk;
+    }
+    
+    return Drain();
+}
+
+// Image-layout transition for one subresource range
+static void RecordImageBarrier(VkCommandBuffer command_buffer, VkImage image, const VkImageSubresourceRange& range,
+                               VkImageLayout old_layout, VkImageLayout new_layout,
+                               VkAccessFlags src_access, VkAccessFlags dst_access,
+                               VkPipelineStageFlags src_stage, VkPipelineStageFlags dst_stage) {
+    VkImageMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = src_access;
+    barrier.dstAccessMask = dst_access;
+    barrier.oldLayout = old_layout;
+    barrier.newLayout = new_layout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange = range;
+    vkCmdPipelineBarrier(command_buffer, src_stage, dst_stage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+static VkImageSubresourceRange SubresourceRange(const VkImageSubresourceLayers& layers) {
+    VkImageSubresourceRange range = {};
+    range.aspectMask = layers.aspectMask;
+    range.baseMipLevel = layers.mipLevel;
+    range.levelCount = 1;
+    range.baseArrayLayer = layers.baseArrayLayer;
+    range.layerCount = layers.layerCount;
+    return range;
+}
+
+// Splits a subresource copy into regions that each fit one staging segment: as many whole depth
+// slices as fit, otherwise bands of rows within a slice. bufferOffset is the region's offset into
+// the tightly packed host data; callers replace it with the segment offset when recording.
+static std::vector<VkBufferImageCopy> SplitImageCopies(const VkImageSubresourceLayers& subresource, VkExtent3D extent,
+                                                       size_t texel_size, size_t segment_size) {
+    std::vector<VkBufferImageCopy> regions;
+    size_t row_bytes = static_cast<size_t>(extent.width) * texel_size;
+    size_t slice_bytes = row_bytes * extent.height;
+    
+    if (slice_bytes <= segment_size) {
+        uint32_t slices = static_cast<uint32_t>(std::min<size_t>(segment_size / slice_bytes, extent.depth));
+        for (uint32_t z = 0; z < extent.depth; z += slices) {
+            VkBufferImageCopy& region = regions.emplace_back();
+            region = {};
+            region.bufferOffset = z * slice_bytes;
+            region.imageSubresource = subresource;
+            region.imageOffset = {0, 0, static_cast<int32_t>(z)};
+            region.imageExtent = {extent.width, extent.height, std::min(slices, extent.depth - z)};
+        }
+        return regions;
+    }
+    
+    uint32_t rows = static_cast<uint32_t>(segment_size / row_bytes);
+    for (uint32_t z = 0; z < extent.depth; ++z) {
+        for (uint32_t y = 0; y < extent.height; y += rows) {
+            VkBufferImageCopy& region = regions.emplace_back();
+            region = {};
+            region.bufferOffset = z * slice_bytes + y * row_bytes;
+            region.imageSubresource = subresource;
+            region.imageOffset = {0, static_cast<int32_t>(y), static_cast<int32_t>(z)};
+            region.imageExtent = {extent.width, std::min(rows, extent.height - y), 1};
+        }
+    }
+    return regions;
+}
+
+Result<void> VulkanStagingRing::InitializeImage(VkImage image, const VkImageSubresourceRange& range) {
+    uint32_t index = 0;
+    auto segment_result = BeginSegment(index);
+    if (!segment_result) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     segment_result.GetError().message);
+    }
+    Segment& segment = *segment_result.GetValue();
+    
+    RecordImageBarrier(segment.command_buffer, image, range, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL,
+                       0, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+                          VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
+                       VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT);
+    
+    auto submit_result = SubmitSegment(segment);
+    if (!submit_result) {
+        return submit_result;
+    }
+    return Drain();
+}
+
+Result<void> VulkanStagingRing::UploadImage(VkImage dst, const VkImageSubresourceLayers& subresource, VkExtent3D extent,
+                                            uint32_t texel_size, const void* data) {
+    if (static_cast<size_t>(extent.width) * texel_size > kSegmentSize) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Image row exceeds the staging segment size");
+    }
+    
+    const uint8_t* src = static_cast<const uint8_t*>(data);
+    VkImageSubresourceRange range = SubresourceRange(subresource);
+    
+    for (VkBufferImageCopy region : SplitImageCopies(subresource, extent, texel_size, kSegmentSize)) {
+        uint32_t index = 0;
+        auto segment_result = BeginSegment(index);
+        if (!segment_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         segment_result.GetError().message);
+        }
+        Segment& segment = *segment_result.GetValue();
+        
+        size_t chunk = static_cast<size_t>(region.imageExtent.width) * region.imageExtent.height *
+                       region.imageExtent.depth * texel_size;
+        std::memcpy(mapped_ + index * kSegmentSize, src + region.bufferOffset, chunk);
+        region.bufferOffset = index * kSegmentSize;
+        
+        // Earlier dispatches may still be using the image; the transition keeps existing contents
+        RecordImageBarrier(segment.command_buffer, dst, range, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                           VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+                           VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        vkCmdCopyBufferToImage(segment.command_buffer, buffer_, dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+        RecordImageBarrier(segment.command_buffer, dst, range, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL,
+                           VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+                           VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        
+        auto submit_result = SubmitSegment(segment);
+        if (!submit_result) {
+            return submit_result;
+        }
+    }
+    
+    return Drain();
+}
+
+Result<void> VulkanStagingRing::DownloadImage(VkImage src, const VkImageSubresourceLayers& subresource, VkExtent3D extent,
+                                              uint32_t texel_size, void* data) {
+    if (static_cast<size_t>(extent.width) * texel_size > kSegmentSize) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Image row exceeds the staging segment size");
+    }
+    
+    uint8_t* dst = static_cast<uint8_t*>(data);
+    VkImageSubresourceRange range = SubresourceRange(subresource);
+    
+    for (VkBufferImageCopy region : SplitImageCopies(subresource, extent, texel_size, kSegmentSize)) {
+        uint32_t index = 0;
+        auto segment_result = BeginSegment(index);
+        if (!segment_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         segment_result.GetError().message);
+        }
+        Segment& segment = *segment_result.GetValue();
+        
+        size_t chunk = static_cast<size_t>(region.imageExtent.width) * region.imageExtent.height *
+                       region.imageExtent.depth * texel_size;
+        size_t host_offset = static_cast<size_t>(region.bufferOffset);
+        region.bufferOffset = index * kSegmentSize;
+        
+        // Wait for shader writes from earlier dispatches before reading the image
+        RecordImageBarrier(segment.command_buffer, src, range, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                           VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        vkCmdCopyImageToBuffer(segment.command_buffer, src, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer_, 1, &region);
+        RecordImageBarrier(segment.command_buffer, src, range, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL,
+                           0, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+                           VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        
+        // Make the staged texels visible to host reads
+        VkBufferMemoryBarrier host_barrier = {};
+        host_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        host_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        host_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        host_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        host_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        host_barrier.buffer = buffer_;
+        host_barrier.offset = region.bufferOffset;
+        host_barrier.size = chunk;
+        vkCmdPipelineBarrier(segment.command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                             0, 0, nullptr, 1, &host_barrier, 0, nullptr);
+        
+        auto submit_result = SubmitSegment(segment);
+        if (!submit_result) {
+            return submit_result;
+        }
+        segment.readback_dst = dst + host_offset;
+        segment.readback_size = chunk;
+    }
+    
+    return Drain();
+}
+
+// The staging ring is shared per device and created on first use
+static Result<VulkanStagingRing*> GetStagingRing(VulkanDevice* device) {
+    if (!device->staging_ring) {
+        auto ring = std::make_unique<VulkanStagingRing>(device);
+        auto init_result = ring->Initialize();
+        if (!init_result) {
+            return KERNTOPIA_RESULT_ERROR(VulkanStagingRing*, ErrorCategory::BACKEND, ErrorCode::BACKEND_INIT_FAILED,
+                                         init_result.GetError().message);
+        }
+        device->staging_ring = std::move(ring);
+    }
+    return Result<VulkanStagingRing*>::Success(device->staging_ring.get());
+}
+
+// VulkanMemoryAllocator implementation
+VulkanMemoryAllocator::VulkanMemoryAllocator(VulkanDevice* device) : device_(device) {
+    vkGetPhysicalDeviceMemoryProperties(device_->physical_device, &memory_properties_);
+}
+
+void VulkanMemoryAllocator::ChainDeviceAddressFlags(VkMemoryAllocateInfo& alloc_info, VkMemoryAllocateFlagsInfo& flags_info) const {
+    // Buffers created with SHADER_DEVICE_ADDRESS usage must be bound to memory allocated for addresses
+    if (device_->buffer_device_address) {
+        flags_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        flags_info.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        alloc_info.pNext = &flags_info;
+    }
+}
+
+uint32_t VulkanMemoryAllocator::OrderFor(VkDeviceSize size) {
+    uint32_t order = 0;
+    while ((kMinAllocation << order) < size) {
+        ++order;
+    }
+    return order;
+}
+
+void* VulkanMemoryAllocator::MapIfHostVisible(VkDeviceMemory memory, uint32_t memory_type, VkDeviceSize size) {
+    if (!(memory_properties_.memoryTypes[memory_type].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)) {
+        return nullptr;
+    }
+    
+    void* mapped = nullptr;
+    VkResult result = vkMapMemory(device_->logical_device, memory, 0, size, 0, &mapped);
+    if (result != VK_SUCCESS) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Failed to map host-visible memory: " + VulkanResultString(result));
+        return nullptr;
+    }
+    return mapped;
+}
+
+Result<VulkanMemoryAllocator::Block*> VulkanMemoryAllocator::CreateBlock(uint32_t memory_type, bool optimal_tiling) {
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = kBlockSize;
+    alloc_info.memoryTypeIndex = memory_type;
+    VkMemoryAllocateFlagsInfo flags_info = {};
+    if (!optimal_tiling) {
+        ChainDeviceAddressFlags(alloc_info, flags_info);
+    }
+    
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkResult result = vkAllocateMemory(device_->logical_device, &alloc_info, nullptr, &memory);
+    if (result != VK_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(Block*, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                     "Failed to allocate memory block: " + VulkanResultString(result));
+    }
+    
+    auto block = std::make_unique<Block>();
+    block->memory = memory;
+    block->memory_type = memory_type;
+    block->optimal_tiling = optimal_tiling;
+    block->mapped = MapIfHostVisible(memory, memory_type, kBlockSize);
+    block->free_lists.resize(OrderFor(kBlockSize) + 1);
+    block->free_lists.back().insert(0);
+    blocks_.push_back(std::move(block));
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Vulkan memory block allocated: " + std::to_string(kBlockSize >> 20) +
+                       " MB, memory type " + std::to_string(memory_type) + (optimal_tiling ? ", images" : "") +
+                       " (" + std::to_string(blocks_.size()) + " blocks)");
+    return Result<Block*>::Success(blocks_.back().get());
+}
+
+Result<VulkanAllocation> VulkanMemoryAllocator::AllocateDedicated(VkDeviceSize size, uint32_t memory_type) {
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = size;
+    alloc_info.memoryTypeIndex = memory_type;
+    VkMemoryAllocateFlagsInfo flags_info = {};
+    ChainDeviceAddressFlags(alloc_info, flags_info);
+    
+    VulkanAllocation allocation;
+    VkResult result = vkAllocateMemory(device_->logical_device, &alloc_info, nullptr, &allocation.memory);
+    if (result != VK_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(VulkanAllocation, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                     "Failed to allocate memory: " + VulkanResultString(result));
+    }
+    
+    allocation.size = size;
+    allocation.requested_size = size;
+    allocation.mapped = MapIfHostVisible(allocation.memory, memory_type, size);
+    allocation.memory_type = memory_type;
+    allocation.dedicated = true;
+    dedicated_count_++;
+    dedicated_bytes_ += size;
+    return Result<VulkanAllocation>::Success(allocation);
+}
+
+Result<VulkanAllocation> VulkanMemoryAllocator::Allocate(const VkMemoryRequirements& requirements, uint32_t memory_type,
+                                                         bool optimal_tiling) {
+    // Buddy ranges are aligned to their own size, so alignment only raises the size class
+    VkDeviceSize size = std::max({requirements.size, requirements.alignment, kMinAllocation});
+    if (size > kBlockSize / 2) {
+        return AllocateDedicated(requirements.size, memory_type);
+    }
+    uint32_t order = OrderFor(size);
+    
+    // Best fit across blocks: the smallest free range that still holds the request
+    Block* chosen = nullptr;
+    uint32_t chosen_order = 0;
+    for (auto& block : blocks_) {
+        if (block->memory_type != memory_type || block->optimal_tiling != optimal_tiling) {
+            continue;
+        }
+        for (uint32_t k = order; k < block->free_lists.size(); ++k) {
+            if (!block->free_lists[k].empty()) {
+                if (!chosen || k < chosen_order) {
+                    chosen = block.get();
+                    chosen_order = k;
+                }
+                break;
+            }
+        }
+        if (chosen && chosen_order == order) {
+            break;
+        }
+    }
+    
+    if (!chosen) {
+        auto block_result = CreateBlock(memory_type, optimal_tiling);
+        if (!block_result) {
+            // The heap may not fit another block but can still fit this request on its own
+            KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, block_result.GetError().message + " - using a dedicated allocation");
+            return AllocateDedicated(requirements.size, memory_type);
+        }
+        chosen = block_result.GetValue();
+        chosen_order = static_cast<uint32_t>(chosen->free_lists.size() - 1);
+    }
+    
+    // Split down to the requested order, leaving each upper half free
+    auto first = chosen->free_lists[chosen_order].begin();
+    VkDeviceSize offset = *first;
+    chosen->free_lists[chosen_order].erase(first);
+    while (chosen_order > order) {
+        --chosen_order;
+        chosen->free_lists[chosen_order].insert(offset + (kMinAllocation << chosen_order));
+    }
+    chosen->allocated[offset] = order;
+    chosen->used += kMinAllocation << order;
+    requested_bytes_ += requirements.size;
+    
+    VulkanAllocation allocation;
+    allocation.memory = chosen->memory;
+    allocation.offset = offset;
+    allocation.size = kMinAllocation << order;
+    allocation.requested_size = requirements.size;
+    allocation.mapped = chosen->mapped ? static_cast<uint8_t*>(chosen->mapped) + offset : nullptr;
+    allocation.memory_type = memory_type;
+    allocation.block = chosen;
+    return Result<VulkanAllocation>::Success(allocation);
+}
+
+void VulkanMemoryAllocator::Free(const VulkanAllocation& allocation) {
+    if (allocation.memory == VK_NULL_HANDLE) {
+        return;
+    }
+    VkDevice device = device_->logical_device;
+    
+    if (allocation.dedicated) {
+        if (allocation.mapped) {
+            vkUnmapMemory(device, allocation.memory);
+        }
+        vkFreeMemory(device, allocation.memory, nullptr);
+        dedicated_count_--;
+        dedicated_bytes_ -= allocation.size;
+        return;
+    }
+    
+    Block* block = static_cast<Block*>(allocation.block);
+    auto it = block->allocated.find(allocation.offset);
+    if (it == block->allocated.end()) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Ignoring free of unknown allocation at offset " + std::to_string(allocation.offset));
+        return;
+    }
+    uint32_t order = it->second;
+    block->allocated.erase(it);
+    block->used -= kMinAllocation << order;
+    requested_bytes_ -= allocation.requested_size;
+    
+    // Merge with free buddies as far up as they go
+    VkDeviceSize offset = allocation.offset;
+    uint32_t max_order = static_cast<uint32_t>(block->free_lists.size() - 1);
+    while (order < max_order) {
+        VkDeviceSize buddy = offset ^ (kMinAllocation << order);
+        auto buddy_it = block->free_lists[order].find(buddy);
+        if (buddy_it == block->free_lists[order].end()) {
+            break;
+        }
+        block->free_lists[order].erase(buddy_it);
+        offset = std::min(offset, buddy);
+        ++order;
+    }
+    block->free_lists[order].insert(offset);
+    
+    // Keep one empty block per memory type (and tiling) for reuse and return the rest to the driver
+    if (block->allocated.empty()) {
+        for (auto other = blocks_.begin(); other != blocks_.end(); ++other) {
+            if (other->get() != block && (*other)->memory_type == block->memory_type &&
+                (*other)->optimal_tiling == block->optimal_tiling && (*other)->allocated.empty()) {
+                if (block->mapped) {
+                    vkUnmapMemory(device, block->memory);
+                }
+                vkFreeMemory(device, block->memory, nullptr);
+                blocks_.erase(std::find_if(blocks_.begin(), blocks_.end(),
+                                           [block](const std::unique_ptr<Block>& b) { return b.get() == block; }));
+                KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "Vulkan memory block released (" + std::to_string(blocks_.size()) + " blocks)");
+                break;
+            }
+        }
+    }
+}
+
+void VulkanMemoryAllocator::Destroy() {
+    if (blocks_.empty()) {
+        return;
+    }
+    if (!device_ || !device_->logical_device) {
+        blocks_.clear();
+        return;
+    }
+    
+    size_t live = 0;
+    for (const auto& block : blocks_) {
+        live += block->allocated.size();
+    }
+    if (live > 0) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "Releasing memory blocks with " + std::to_string(live) + " live allocations");
+    }
+    
+    for (const auto& block : blocks_) {
+        if (block->mapped) {
+            vkUnmapMemory(device_->logical_device, block->memory);
+        }
+        vkFreeMemory(device_->logical_device, block->memory, nullptr);
+    }
+    blocks_.clear();
+}
+
+VulkanMemoryAllocator::Stats VulkanMemoryAllocator::GetStats() const {
+    Stats stats;
+    VkDeviceSize free_bytes = 0;
+    for (const auto& block : blocks_) {
+        stats.block_count++;
+        stats.allocation_count += static_cast<uint32_t>(block->allocated.size());
+        stats.reserved_bytes += kBlockSize;
+        stats.used_bytes += block->used;
+        for (uint32_t k = 0; k < block->free_lists.size(); ++k) {
+            if (!block->free_lists[k].empty()) {
+                free_bytes += (kMinAllocation << k) * block->free_lists[k].size();
+                stats.largest_free_bytes = std::max(stats.largest_free_bytes, kMinAllocation << k);
+            }
+        }
+    }
+    stats.dedicated_count = dedicated_count_;
+    stats.allocation_count += dedicated_count_;
+    stats.dedicated_bytes = dedicated_bytes_;
+    stats.requested_bytes = requested_bytes_;
+    stats.fragmentation = free_bytes > 0 ? 1.0f - static_cast<float>(stats.largest_free_bytes) / free_bytes : 0.0f;
+    return stats;
+}
+
+// Buffers and images share one allocator per device, created on first use
+static VulkanMemoryAllocator* GetAllocator(VulkanDevice* device) {
+    if (!device->allocator) {
+        device->allocator = std::make_unique<VulkanMemoryAllocator>(device);
+    }
+    return device->allocator.get();
+}
+
+static VkBufferUsageFlags BufferUsageFlags(IBuffer::Type type, IBuffer::Usage usage, const VulkanDevice* device) {
+    // Determine buffer usage flags based on buffer type and usage
+    VkBufferUsageFlags usage_flags = 0;
+    if (type == IBuffer::Type::STORAGE || usage == IBuffer::Usage::DYNAMIC) {
+        usage_flags = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    } else if (type == IBuffer::Type::UNIFORM) {
+        usage_flags = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    } else {
+        usage_flags = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT; // Default to storage buffer
     }
     
-    // Return 0 as fallback - caller should check if allocation succeeds
-    return 0;
+    // Add transfer bits for host-device transfers
+    usage_flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    
+    // Kernel-facing buffers can also be reached through a pointer in push constants
+    if (device->buffer_device_address && type != IBuffer::Type::STAGING) {
+        usage_flags |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+    return usage_flags;
 }
 
 // VulkanBuffer implementation
@@ -69,6 +1013,11 @@ VulkanBuffer::VulkanBuffer(VulkanDevice* device, size_t size, Type type, Usage u
     CreateBuffer();
 }
 
+VulkanBuffer::VulkanBuffer(VulkanDevice* device, void* host_pointer, size_t size, Type type)
+    : device_(device), size_(size), type_(type), usage_(Usage::DYNAMIC) {
+    ImportHostMemory(host_pointer);
+}
+
 VulkanBuffer::~VulkanBuffer() {
     DestroyBuffer();
 }
@@ -78,20 +1027,30 @@ void* VulkanBuffer::Map() {
         return mapped_ptr_;
     }
     
-    VkDeviceMemory vk_memory = static_cast<VkDeviceMemory>(device_memory_);
-    if (!device_ || !device_->logical_device || vk_memory == VK_NULL_HANDLE) {
+    // Imported host memory is coherent and addressed directly
+    if (host_pointer_) {
+        mapped_ptr_ = host_pointer_;
+        is_mapped_ = true;
+        return mapped_ptr_;
+    }
+    
+    if (device_local_) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanBuffer::Map - Buffer is device-local; use UploadData/DownloadData");
+        return nullptr;
+    }
+    
+    if (!device_ || !device_->logical_device || !allocation_) {
         KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanBuffer::Map - Invalid device or memory");
         return nullptr;
     }
     
-    // Map the entire buffer memory using dynamically loaded function
-    VkResult result = vkMapMemory(device_->logical_device, vk_memory, 0, size_, 0, &mapped_ptr_);
-    if (result != VK_SUCCESS) {
-        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, 
-            "VulkanBuffer::Map - Failed to map memory: " + VulkanResultString(result));
+    // The allocator keeps host-visible memory mapped, since buffers may share a VkDeviceMemory
+    if (!allocation_->mapped) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanBuffer::Map - Buffer memory is not mapped");
         return nullptr;
     }
     
+    mapped_ptr_ = allocation_->mapped;
     is_mapped_ = true;
     KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanBuffer mapped " + std::to_string(size_) + " bytes");
     return mapped_ptr_;
@@ -100,14 +1059,7 @@ void* VulkanBuffer::Map() {
 void VulkanBuffer::Unmap() {
     if (!is_mapped_) return;
     
-    VkDeviceMemory vk_memory = static_cast<VkDeviceMemory>(device_memory_);
-    if (!device_ || !device_->logical_device || vk_memory == VK_NULL_HANDLE) {
-        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanBuffer::Unmap - Invalid device or memory");
-        return;
-    }
-    
-    // Unmap the memory using dynamically loaded function
-    vkUnmapMemory(device_->logical_device, vk_memory);
+    // Memory stays mapped by the allocator (coherent, so no flush is needed)
     mapped_ptr_ = nullptr;
     is_mapped_ = false;
     
@@ -120,17 +1072,86 @@ Result<void> VulkanBuffer::UploadData(const void* data, size_t size, size_t offs
                                      "Upload data exceeds buffer size");
     }
     
-    // Simplified implementation - in real Vulkan would use staging buffer
+    // Staging copies are ordered on the queue; mapped writes must not overtake a pending dispatch
+    if (!device_local_) {
+        auto await_result = device_->AwaitIssuedWork();
+        if (!await_result) {
+            return await_result;
+        }
+    }
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    
+    if (device_local_) {
+        auto ring_result = GetStagingRing(device_);
+        if (!ring_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         ring_result.GetError().message);
+        }
+        auto upload_result = ring_result.GetValue()->Upload(static_cast<VkBuffer>(buffer_), data, size, offset);
+        if (!upload_result) {
+            return upload_result;
+        }
+    } else {
+        void* mapped = Map();
+        if (!mapped) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                         "Failed to map buffer for upload");
+        }
+        
+        // Imported host memory uploaded from itself is already in place
+        if (static_cast<uint8_t*>(mapped) + offset != data) {
+            std::memcpy(static_cast<uint8_t*>(mapped) + offset, data, size);
+        }
+        Unmap();
+    }
+    
+    device_->upload_time_ms += std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - start).count();
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanBuffer uploaded " + std::to_string(size) + " bytes");
+    return KERNTOPIA_VOID_SUCCESS();
+}
+
+Result<void> VulkanBuffer::UploadAsync(const void* data, size_t size, size_t offset, void* signal_semaphore) {
+    VkSemaphore signal = static_cast<VkSemaphore>(signal_semaphore);
+    if (offset + size > size_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Upload data exceeds buffer size");
+    }
+    
+    if (device_local_) {
+        auto ring_result = GetStagingRing(device_);
+        if (!ring_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         ring_result.GetError().message);
+        }
+        return ring_result.GetValue()->UploadAsync(static_cast<VkBuffer>(buffer_), data, size, offset, signal);
+    }
+    
     void* mapped = Map();
     if (!mapped) {
         return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
                                      "Failed to map buffer for upload");
     }
-    
-    std::memcpy(static_cast<uint8_t*>(mapped) + offset, data, size);
+    if (static_cast<uint8_t*>(mapped) + offset != data) {
+        std::memcpy(static_cast<uint8_t*>(mapped) + offset, data, size);
+    }
     Unmap();
     
-    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanBuffer uploaded " + std::to_string(size) + " bytes");
+    // Coherent host writes are visible to later submissions; the empty batch keeps the hand-off uniform
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &signal;
+    VulkanTimelineSignal timeline_signal;
+    uint64_t token = device_->AttachCompletionSignal(submit_info, timeline_signal);
+    VkResult result = vkQueueSubmit(device_->compute_queue, 1, &submit_info, VK_NULL_HANDLE);
+    if (result != VK_SUCCESS) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     "Failed to signal upload semaphore: " + VulkanResultString(result));
+    }
+    device_->completion_token = token;
     return KERNTOPIA_VOID_SUCCESS();
 }
 
@@ -140,14 +1161,41 @@ Result<void> VulkanBuffer::DownloadData(void* data, size_t size, size_t offset)
                                      "Download data exceeds buffer size");
     }
     
-    void* mapped = Map();
-    if (!mapped) {
-        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
-                                     "Failed to map buffer for download");
+    // Mapped reads would otherwise see a dispatch that is still writing the buffer
+    if (!device_local_) {
+        auto await_result = device_->AwaitIssuedWork();
+        if (!await_result) {
+            return await_result;
+        }
     }
     
-    std::memcpy(data, static_cast<const uint8_t*>(mapped) + offset, size);
-    Unmap();
+    auto start = std::chrono::high_resolution_clock::now();
+    
+    if (device_local_) {
+        auto ring_result = GetStagingRing(device_);
+        if (!ring_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                         ring_result.GetError().message);
+        }
+        auto download_result = ring_result.GetValue()->Download(static_cast<VkBuffer>(buffer_), data, size, offset);
+        if (!download_result) {
+            return download_result;
+        }
+    } else {
+        void* mapped = Map();
+        if (!mapped) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                         "Failed to map buffer for download");
+        }
+        
+        if (static_cast<const uint8_t*>(mapped) + offset != data) {
+            std::memcpy(data, static_cast<const uint8_t*>(mapped) + offset, size);
+        }
+        Unmap();
+    }
+    
+    device_->download_time_ms += std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - start).count();
     
     KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanBuffer downloaded " + std::to_string(size) + " bytes");
     return KERNTOPIA_VOID_SUCCESS();
@@ -159,25 +1207,15 @@ bool VulkanBuffer::CreateBuffer() {
         return false;
     }
     
-    // Determine buffer usage flags based on buffer type and usage
-    VkBufferUsageFlags usage_flags = 0;
-    if (type_ == Type::STORAGE || usage_ == Usage::DYNAMIC) {
-        usage_flags = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    } else if (type_ == Type::UNIFORM) {
-        usage_flags = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
-    } else {
-        usage_flags = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT; // Default to storage buffer
-    }
-    
-    // Add transfer bits for host-device transfers
-    usage_flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    VkBufferUsageFlags usage_flags = BufferUsageFlags(type_, usage_, device_);
     
     // Create buffer using dynamically loaded function
     VkBufferCreateInfo buffer_info = {};
     buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     buffer_info.size = size_;
     buffer_info.usage = usage_flags;
-    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    uint32_t queue_families[2];
+    SetBufferSharing(buffer_info, device_, queue_families);
     
     VkBuffer vk_buffer;
     VkResult result = vkCreateBuffer(device_->logical_device, &buffer_info, nullptr, &vk_buffer);
@@ -194,48 +1232,178 @@ bool VulkanBuffer::CreateBuffer() {
     VkMemoryRequirements mem_requirements;
     vkGetBufferMemoryRequirements(device_->logical_device, vk_buffer, &mem_requirements);
     
-    // Determine memory properties - prefer host visible for CPU access
-    VkMemoryPropertyFlags memory_properties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    // Placement: kernel-facing data (storage buffers, static contents) lives in device-local memory,
+    // while staging and per-frame stream buffers stay host visible. On unified-memory devices the
+    // device-local heap is host visible anyway, so those buffers are mapped directly.
+    bool wants_device_local = (type_ == Type::STORAGE || usage_ == Usage::STATIC) &&
+                              type_ != Type::STAGING && usage_ != Usage::STREAM;
     
-    // Find suitable memory type
-    uint32_t memory_type_index = FindMemoryType(device_->physical_device, 
-                                               mem_requirements.memoryTypeBits, 
-                                               memory_properties);
+    VkMemoryPropertyFlags host_properties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    VkMemoryPropertyFlags memory_properties = host_properties;
+    uint32_t memory_type_index = 0;
+    device_local_ = false;
     
-    // Allocate memory using dynamically loaded function
-    VkMemoryAllocateInfo alloc_info = {};
-    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    alloc_info.allocationSize = mem_requirements.size;
-    alloc_info.memoryTypeIndex = memory_type_index;
+    if (wants_device_local && device_->unified_memory &&
+        TryFindMemoryType(device_->physical_device, mem_requirements.memoryTypeBits,
+                          VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | host_properties, memory_type_index)) {
+        memory_properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | host_properties;
+    } else if (wants_device_local && !device_->unified_memory &&
+               TryFindMemoryType(device_->physical_device, mem_requirements.memoryTypeBits,
+                                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, memory_type_index)) {
+        memory_properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        device_local_ = true;
+    } else {
+        // Host-visible fallback
+        memory_type_index = FindMemoryType(device_->physical_device, 
+                                           mem_requirements.memoryTypeBits, 
+                                           memory_properties);
+    }
     
-    VkDeviceMemory vk_memory;
-    result = vkAllocateMemory(device_->logical_device, &alloc_info, nullptr, &vk_memory);
-    if (result != VK_SUCCESS) {
+    // Sub-allocate from a shared block instead of one vkAllocateMemory per buffer
+    VulkanMemoryAllocator* allocator = GetAllocator(device_);
+    auto allocation_result = allocator->Allocate(mem_requirements, memory_type_index);
+    if (!allocation_result) {
         KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, 
-            "VulkanBuffer::CreateBuffer - Failed to allocate memory: " + VulkanResultString(result));
+            "VulkanBuffer::CreateBuffer - Failed to allocate memory: " + allocation_result.GetError().message);
         vkDestroyBuffer(device_->logical_device, vk_buffer, nullptr);
         buffer_ = nullptr;
         return false;
     }
+    allocation_ = std::make_unique<VulkanAllocation>(allocation_result.GetValue());
     
     // Store as void*
-    device_memory_ = static_cast<void*>(vk_memory);
+    device_memory_ = static_cast<void*>(allocation_->memory);
     
-    // Bind buffer to memory using dynamically loaded function
-    result = vkBindBufferMemory(device_->logical_device, vk_buffer, vk_memory, 0);
+    // Bind buffer to its range of the block
+    result = vkBindBufferMemory(device_->logical_device, vk_buffer, allocation_->memory, allocation_->offset);
     if (result != VK_SUCCESS) {
         KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, 
             "VulkanBuffer::CreateBuffer - Failed to bind buffer memory: " + VulkanResultString(result));
-        vkFreeMemory(device_->logical_device, vk_memory, nullptr);
+        allocator->Free(*allocation_);
+        allocation_.reset();
         vkDestroyBuffer(device_->logical_device, vk_buffer, nullptr);
         buffer_ = nullptr;
         device_memory_ = nullptr;
         return false;
     }
     
+    if (usage_flags & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) {
+        VkBufferDeviceAddressInfo address_info = {};
+        address_info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+        address_info.buffer = vk_buffer;
+        device_address_ = vkGetBufferDeviceAddress(device_->logical_device, &address_info);
+    }
+    
     KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, 
         "VulkanBuffer created: " + std::to_string(size_) + " bytes, usage=0x" + 
-        std::to_string(usage_flags) + ", memory_type=" + std::to_string(memory_type_index));
+        std::to_string(usage_flags) + ", memory_type=" + std::to_string(memory_type_index) +
+        (allocation_->dedicated ? ", dedicated" : ", offset " + std::to_string(allocation_->offset)) +
+        (device_local_ ? " (device-local, staged)" : " (host-visible)"));
+    return true;
+}
+
+bool VulkanBuffer::ImportHostMemory(void* host_pointer) {
+    if (!device_ || !device_->logical_device || !device_->external_memory_host) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanBuffer::ImportHostMemory - VK_EXT_external_memory_host not enabled");
+        return false;
+    }
+    // Pointer and size must be multiples of minImportedHostPointerAlignment, read when the device was created
+    const VkDeviceSize import_alignment = device_->host_import_alignment;
+    if (!host_pointer || size_ == 0 || reinterpret_cast<uintptr_t>(host_pointer) % import_alignment != 0) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanBuffer::ImportHostMemory - Host memory must be non-empty and " +
+                            std::to_string(import_alignment) + "-byte aligned");
+        return false;
+    }
+    
+    VkBufferUsageFlags usage_flags = BufferUsageFlags(type_, usage_, device_);
+    VkExternalMemoryBufferCreateInfo external_info = {};
+    external_info.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    external_info.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.pNext = &external_info;
+    buffer_info.size = size_;
+    buffer_info.usage = usage_flags;
+    uint32_t queue_families[2];
+    SetBufferSharing(buffer_info, device_, queue_families);
+    
+    VkBuffer vk_buffer;
+    VkResult result = vkCreateBuffer(device_->logical_device, &buffer_info, nullptr, &vk_buffer);
+    if (result != VK_SUCCESS) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND,
+            "VulkanBuffer::ImportHostMemory - Failed to create buffer: " + VulkanResultString(result));
+        return false;
+    }
+    
+    VkMemoryRequirements mem_requirements;
+    vkGetBufferMemoryRequirements(device_->logical_device, vk_buffer, &mem_requirements);
+    
+    // The memory type has to suit both the buffer and the pointer; coherent so no flushes are needed
+    VkMemoryHostPointerPropertiesEXT pointer_properties = {};
+    pointer_properties.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+    result = vkGetMemoryHostPointerPropertiesEXT(device_->logical_device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT,
+                                                 host_pointer, &pointer_properties);
+    uint32_t memory_type_index = 0;
+    if (result != VK_SUCCESS ||
+        !TryFindMemoryType(device_->physical_device, mem_requirements.memoryTypeBits & pointer_properties.memoryTypeBits,
+                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, memory_type_index)) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanBuffer::ImportHostMemory - No coherent memory type can import the pointer" +
+                            (result != VK_SUCCESS ? ": " + VulkanResultString(result) : std::string()));
+        vkDestroyBuffer(device_->logical_device, vk_buffer, nullptr);
+        return false;
+    }
+    
+    // Imports cover whole alignment units; HostImportAllocator rounds allocations to whole pages to match
+    VkDeviceSize import_size = std::max<VkDeviceSize>(size_, mem_requirements.size);
+    import_size = (import_size + import_alignment - 1) / import_alignment * import_alignment;
+    
+    VkMemoryAllocateFlagsInfo flags_info = {};
+    flags_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+    flags_info.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+    
+    VkImportMemoryHostPointerInfoEXT import_info = {};
+    import_info.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+    import_info.pNext = (usage_flags & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) ? &flags_info : nullptr;
+    import_info.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    import_info.pHostPointer = host_pointer;
+    
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.pNext = &import_info;
+    alloc_info.allocationSize = import_size;
+    alloc_info.memoryTypeIndex = memory_type_index;
+    
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    result = vkAllocateMemory(device_->logical_device, &alloc_info, nullptr, &memory);
+    if (result == VK_SUCCESS) {
+        result = vkBindBufferMemory(device_->logical_device, vk_buffer, memory, 0);
+        if (result != VK_SUCCESS) {
+            vkFreeMemory(device_->logical_device, memory, nullptr);
+        }
+    }
+    if (result != VK_SUCCESS) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND,
+            "VulkanBuffer::ImportHostMemory - Failed to import host memory: " + VulkanResultString(result));
+        vkDestroyBuffer(device_->logical_device, vk_buffer, nullptr);
+        return false;
+    }
+    
+    buffer_ = static_cast<void*>(vk_buffer);
+    device_memory_ = static_cast<void*>(memory);
+    host_pointer_ = host_pointer;
+    device_local_ = false;
+    
+    if (usage_flags & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) {
+        VkBufferDeviceAddressInfo address_info = {};
+        address_info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+        address_info.buffer = vk_buffer;
+        device_address_ = vkGetBufferDeviceAddress(device_->logical_device, &address_info);
+    }
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND,
+        "VulkanBuffer imported " + std::to_string(size_) + " bytes of host memory, memory_type=" +
+        std::to_string(memory_type_index));
     return true;
 }
 
@@ -249,7 +1417,10 @@ void VulkanBuffer::DestroyBuffer() {
         KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "VulkanBuffer::DestroyBuffer - Invalid device, clearing handles");
         // Device already destroyed, just clear our handles
         buffer_ = nullptr;
+        device_address_ = 0;
         device_memory_ = nullptr;
+        allocation_.reset();
+        host_pointer_ = nullptr;
         mapped_ptr_ = nullptr;
         is_mapped_ = false;
         return;
@@ -260,22 +1431,33 @@ void VulkanBuffer::DestroyBuffer() {
         Unmap();
     }
     
-    // Clean up Vulkan resources using dynamically loaded functions
-    if (device_memory_ != nullptr) {
-        VkDeviceMemory vk_memory = static_cast<VkDeviceMemory>(device_memory_);
-        vkFreeMemory(device_->logical_device, vk_memory, nullptr);
-        device_memory_ = nullptr;
-    }
-    
+    // Clean up Vulkan resources using dynamically loaded functions; the range is reused once the buffer is gone
     if (buffer_ != nullptr) {
         VkBuffer vk_buffer = static_cast<VkBuffer>(buffer_);
         vkDestroyBuffer(device_->logical_device, vk_buffer, nullptr);
         buffer_ = nullptr;
+        device_address_ = 0;
+    }
+    
+    if (allocation_) {
+        if (device_->allocator) {
+            device_->allocator->Free(*allocation_);
+        }
+        allocation_.reset();
+    } else if (host_pointer_ && device_memory_) {
+        // The import is this buffer's own allocation; the host memory stays with its owner
+        vkFreeMemory(device_->logical_device, static_cast<VkDeviceMemory>(device_memory_), nullptr);
     }
+    device_memory_ = nullptr;
+    host_pointer_ = nullptr;
     
     KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanBuffer destroyed");
 }
 
+size_t VulkanBuffer::GetMemoryOffset() const {
+    return allocation_ ? static_cast<size_t>(allocation_->offset) : 0;
+}
+
 // VulkanTexture implementation
 VulkanTexture::VulkanTexture(VulkanDevice* device, const TextureDesc& desc)
     : device_(device), desc_(desc) {
@@ -286,31 +1468,352 @@ VulkanTexture::~VulkanTexture() {
     DestroyImage();
 }
 
+// Extent of one mip level; 1D textures ignore height and only 3D textures have depth
+static Result<VkExtent3D> SubresourceExtent(const TextureDesc& desc, uint32_t layer_count,
+                                            uint32_t mip_level, uint32_t array_layer) {
+    if (mip_level >= desc.mip_levels) {
+        return KERNTOPIA_RESULT_ERROR(VkExtent3D, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Mip level " + std::to_string(mip_level) + " out of range (" +
+                                     std::to_string(desc.mip_levels) + " levels)");
+    }
+    if (array_layer >= layer_count) {
+        return KERNTOPIA_RESULT_ERROR(VkExtent3D, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Array layer " + std::to_string(array_layer) + " out of range (" +
+                                     std::to_string(layer_count) + " layers)");
+    }
+    
+    VkExtent3D extent;
+    extent.width = std::max(1u, desc.width >> mip_level);
+    extent.height = desc.type == TextureDesc::Type::TEXTURE_1D ? 1 : std::max(1u, desc.height >> mip_level);
+    extent.depth = desc.type == TextureDesc::Type::TEXTURE_3D ? std::max(1u, desc.depth >> mip_level) : 1;
+    return Result<VkExtent3D>::Success(extent);
+}
+
 Result<void> VulkanTexture::UploadData(const void* data, uint32_t mip_level, uint32_t array_layer) {
-    // Simplified placeholder implementation
-    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanTexture upload data for mip " + std::to_string(mip_level));
+    if (!data) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Null texture upload data");
+    }
+    if (image_ == nullptr) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::TEXTURE_CREATION_FAILED,
+                                     "Texture image was not created");
+    }
+    
+    auto extent_result = SubresourceExtent(desc_, layer_count_, mip_level, array_layer);
+    if (!extent_result) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     extent_result.GetError().message);
+    }
+    VkExtent3D extent = extent_result.GetValue();
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    
+    auto ring_result = GetStagingRing(device_);
+    if (!ring_result) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     ring_result.GetError().message);
+    }
+    
+    VkImageSubresourceLayers subresource = {};
+    subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    subresource.mipLevel = mip_level;
+    subresource.baseArrayLayer = array_layer;
+    subresource.layerCount = 1;
+    
+    auto upload_result = ring_result.GetValue()->UploadImage(static_cast<VkImage>(image_), subresource, extent,
+                                                              GetTexelSize(), data);
+    if (!upload_result) {
+        return upload_result;
+    }
+    
+    device_->upload_time_ms += std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - start).count();
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanTexture uploaded mip " + std::to_string(mip_level) +
+                       ", layer " + std::to_string(array_layer) + " (" + std::to_string(extent.width) + "x" +
+                       std::to_string(extent.height) + "x" + std::to_string(extent.depth) + ")");
     return KERNTOPIA_VOID_SUCCESS();
 }
 
 Result<void> VulkanTexture::DownloadData(void* data, size_t data_size, uint32_t mip_level, uint32_t array_layer) {
-    // Simplified placeholder implementation
-    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanTexture download data for mip " + std::to_string(mip_level));
+    if (!data) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Null texture download destination");
+    }
+    if (image_ == nullptr) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::TEXTURE_CREATION_FAILED,
+                                     "Texture image was not created");
+    }
+    
+    auto extent_result = SubresourceExtent(desc_, layer_count_, mip_level, array_layer);
+    if (!extent_result) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     extent_result.GetError().message);
+    }
+    VkExtent3D extent = extent_result.GetValue();
+    
+    size_t required = static_cast<size_t>(extent.width) * extent.height * extent.depth * GetTexelSize();
+    if (data_size < required) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::VALIDATION, ErrorCode::INVALID_ARGUMENT,
+                                     "Texture download needs " + std::to_string(required) + " bytes, got " +
+                                     std::to_string(data_size));
+    }
+    
+    auto start = std::chrono::high_resolution_clock::now();
+    
+    auto ring_result = GetStagingRing(device_);
+    if (!ring_result) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     ring_result.GetError().message);
+    }
+    
+    VkImageSubresourceLayers subresource = {};
+    subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    subresource.mipLevel = mip_level;
+    subresource.baseArrayLayer = array_layer;
+    subresource.layerCount = 1;
+    
+    auto download_result = ring_result.GetValue()->DownloadImage(static_cast<VkImage>(image_), subresource, extent,
+                                                                  GetTexelSize(), data);
+    if (!download_result) {
+        return download_result;
+    }
+    
+    device_->download_time_ms += std::chrono::duration<float, std::milli>(
+        std::chrono::high_resolution_clock::now() - start).count();
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanTexture downloaded mip " + std::to_string(mip_level) +
+                       ", layer " + std::to_string(array_layer) + " (" + std::to_string(required) + " bytes)");
     return KERNTOPIA_VOID_SUCCESS();
 }
 
 bool VulkanTexture::CreateImage() {
-    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanTexture created " + 
-                       std::to_string(desc_.width) + "x" + std::to_string(desc_.height));
+    if (!device_ || !device_->logical_device) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanTexture::CreateImage - Invalid device");
+        return false;
+    }
+    if (desc_.mip_levels == 0 || desc_.array_layers == 0) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanTexture::CreateImage - Mip levels and array layers must be non-zero");
+        return false;
+    }
+    
+    VkDevice device = device_->logical_device;
+    VkFormat format = static_cast<VkFormat>(GetVulkanFormat());
+    
+    // Usage follows what the device supports for this format with optimal tiling
+    VkFormatProperties format_properties = {};
+    vkGetPhysicalDeviceFormatProperties(device_->physical_device, format, &format_properties);
+    
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    storage_ = (format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) != 0;
+    if (storage_) {
+        usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+    } else if (desc_.is_storage) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanTexture::CreateImage - Format " + std::to_string(format) +
+                           " does not support storage images on this device");
+        return false;
+    }
+    if (format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) {
+        usage |= VK_IMAGE_USAGE_SAMPLED_BIT;
+    }
+    if (!(usage & (VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT))) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanTexture::CreateImage - Format " + std::to_string(format) +
+                           " cannot be read by kernels on this device");
+        return false;
+    }
+    if (desc_.generate_mips && desc_.mip_levels > 1) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "VulkanTexture: mip generation is not supported - upload each level explicitly");
+    }
+    
+    VkImageCreateInfo image_info = {};
+    image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_info.format = format;
+    image_info.extent = {desc_.width, 1, 1};
+    image_info.mipLevels = desc_.mip_levels;
+    image_info.arrayLayers = desc_.array_layers;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = usage;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    
+    VkImageViewType view_type = VK_IMAGE_VIEW_TYPE_2D;
+    switch (desc_.type) {
+        case TextureDesc::Type::TEXTURE_1D:
+            image_info.imageType = VK_IMAGE_TYPE_1D;
+            view_type = desc_.array_layers > 1 ? VK_IMAGE_VIEW_TYPE_1D_ARRAY : VK_IMAGE_VIEW_TYPE_1D;
+            break;
+        case TextureDesc::Type::TEXTURE_2D:
+            image_info.imageType = VK_IMAGE_TYPE_2D;
+            image_info.extent.height = desc_.height;
+            view_type = desc_.array_layers > 1 ? VK_IMAGE_VIEW_TYPE_2D_ARRAY : VK_IMAGE_VIEW_TYPE_2D;
+            break;
+        case TextureDesc::Type::TEXTURE_3D:
+            if (desc_.array_layers > 1) {
+                KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanTexture::CreateImage - 3D textures cannot have array layers");
+                return false;
+            }
+            image_info.imageType = VK_IMAGE_TYPE_3D;
+            image_info.extent.height = desc_.height;
+            image_info.extent.depth = std::max(1u, desc_.depth);
+            view_type = VK_IMAGE_VIEW_TYPE_3D;
+            break;
+        case TextureDesc::Type::TEXTURE_CUBE:
+            if (desc_.width != desc_.height) {
+                KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanTexture::CreateImage - Cube faces must be square");
+                return false;
+            }
+            // Six faces per cube, addressed by kernels as a 2D array
+            image_info.imageType = VK_IMAGE_TYPE_2D;
+            image_info.extent.height = desc_.height;
+            image_info.arrayLayers = desc_.array_layers * 6;
+            view_type = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+            break;
+    }
+    layer_count_ = image_info.arrayLayers;
+    
+    VkImage vk_image = VK_NULL_HANDLE;
+    VkResult result = vkCreateImage(device, &image_info, nullptr, &vk_image);
+    if (result != VK_SUCCESS) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, 
+            "VulkanTexture::CreateImage - Failed to create image: " + VulkanResultString(result));
+        return false;
+    }
+    image_ = static_cast<void*>(vk_image);
+    
+    VkMemoryRequirements mem_requirements;
+    vkGetImageMemoryRequirements(device, vk_image, &mem_requirements);
+    
+    // Optimal-tiling images are never mapped, so device-local memory is always the right placement
+    uint32_t memory_type_index = 0;
+    if (!TryFindMemoryType(device_->physical_device, mem_requirements.memoryTypeBits,
+                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, memory_type_index)) {
+        memory_type_index = FindMemoryType(device_->physical_device, mem_requirements.memoryTypeBits, 0);
+    }
+    
+    auto allocation_result = GetAllocator(device_)->Allocate(mem_requirements, memory_type_index, true);
+    if (!allocation_result) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, 
+            "VulkanTexture::CreateImage - Failed to allocate memory: " + allocation_result.GetError().message);
+        DestroyImage();
+        return false;
+    }
+    allocation_ = std::make_unique<VulkanAllocation>(allocation_result.GetValue());
+    device_memory_ = static_cast<void*>(allocation_->memory);
+    
+    result = vkBindImageMemory(device, vk_image, allocation_->memory, allocation_->offset);
+    if (result != VK_SUCCESS) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, 
+            "VulkanTexture::CreateImage - Failed to bind image memory: " + VulkanResultString(result));
+        DestroyImage();
+        return false;
+    }
+    
+    // Kernels access the base level; other levels are reached through uploads and downloads
+    VkImageViewCreateInfo view_info = {};
+    view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    view_info.image = vk_image;
+    view_info.viewType = view_type;
+    view_info.format = format;
+    view_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    view_info.subresourceRange.baseMipLevel = 0;
+    view_info.subresourceRange.levelCount = 1;
+    view_info.subresourceRange.baseArrayLayer = 0;
+    view_info.subresourceRange.layerCount = layer_count_;
+    
+    VkImageView vk_view = VK_NULL_HANDLE;
+    result = vkCreateImageView(device, &view_info, nullptr, &vk_view);
+    if (result != VK_SUCCESS) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, 
+            "VulkanTexture::CreateImage - Failed to create image view: " + VulkanResultString(result));
+        DestroyImage();
+        return false;
+    }
+    image_view_ = static_cast<void*>(vk_view);
+    
+    // Every subresource starts in GENERAL so it can be bound as a storage image straight away
+    auto ring_result = GetStagingRing(device_);
+    if (!ring_result) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, "VulkanTexture::CreateImage - " + ring_result.GetError().message);
+        DestroyImage();
+        return false;
+    }
+    VkImageSubresourceRange full_range = view_info.subresourceRange;
+    full_range.levelCount = desc_.mip_levels;
+    auto layout_result = ring_result.GetValue()->InitializeImage(vk_image, full_range);
+    if (!layout_result) {
+        KERNTOPIA_LOG_ERROR(LogComponent::BACKEND, 
+            "VulkanTexture::CreateImage - Failed to initialize image layout: " + layout_result.GetError().message);
+        DestroyImage();
+        return false;
+    }
+    
+    KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanTexture created: " + std::to_string(image_info.extent.width) + "x" +
+                       std::to_string(image_info.extent.height) + "x" + std::to_string(image_info.extent.depth) +
+                       ", format=" + std::to_string(format) + ", mips=" + std::to_string(desc_.mip_levels) +
+                       ", layers=" + std::to_string(layer_count_) + (storage_ ? ", storage" : ", sampled only") +
+                       (allocation_->dedicated ? ", dedicated" : ", offset " + std::to_string(allocation_->offset)));
     return true;
 }
 
 void VulkanTexture::DestroyImage() {
+    // Safe to call multiple times - check if already destroyed
+    if (image_ == nullptr && image_view_ == nullptr && !allocation_) {
+        return;
+    }
+    
+    if (!device_ || !device_->logical_device) {
+        KERNTOPIA_LOG_WARNING(LogComponent::BACKEND, "VulkanTexture::DestroyImage - Invalid device, clearing handles");
+        image_ = nullptr;
+        image_view_ = nullptr;
+        device_memory_ = nullptr;
+        allocation_.reset();
+        return;
+    }
+    
+    if (image_view_ != nullptr) {
+        vkDestroyImageView(device_->logical_device, static_cast<VkImageView>(image_view_), nullptr);
+        image_view_ = nullptr;
+    }
+    if (image_ != nullptr) {
+        vkDestroyImage(device_->logical_device, static_cast<VkImage>(image_), nullptr);
+        image_ = nullptr;
+    }
+    if (allocation_) {
+        if (device_->allocator) {
+            device_->allocator->Free(*allocation_);
+        }
+        allocation_.reset();
+    }
+    device_memory_ = nullptr;
+    
     KERNTOPIA_LOG_DEBUG(LogComponent::BACKEND, "VulkanTexture destroyed");
 }
 
 uint32_t VulkanTexture::GetVulkanFormat() const {
-    // VK_FORMAT_R8G8B8A8_UNORM = 37 - simplified mapping
-    return 37;
+    switch (desc_.format) {
+        case TextureDesc::Format::R8_UNORM:     return VK_FORMAT_R8_UNORM;
+        case TextureDesc::Format::RG8_UNORM:    return VK_FORMAT_R8G8_UNORM;
+        case TextureDesc::Format::RGBA8_UNORM:  return VK_FORMAT_R8G8B8A8_UNORM;
+        case TextureDesc::Format::R16_FLOAT:    return VK_FORMAT_R16_SFLOAT;
+        case TextureDesc::Format::RGBA16_FLOAT: return VK_FORMAT_R16G16B16A16_SFLOAT;
+        case TextureDesc::Format::R32_FLOAT:    return VK_FORMAT_R32_SFLOAT;
+        case TextureDesc::Format::RGBA32_FLOAT: return VK_FORMAT_R32G32B32A32_SFLOAT;
+    }
+    return VK_FORMAT_R8G8B8A8_UNORM;
+}
+
+uint32_t VulkanTexture::GetTexelSize() const {
+    switch (desc_.format) {
+        case TextureDesc::Format::R8_UNORM:     return 1;
+        case TextureDesc::Format::RG8_UNORM:    return 2;
+        case TextureDesc::Format::RGBA8_UNORM:  return 4;
+        case TextureDesc::Format::R16_FLOAT:    return 2;
+        case TextureDesc::Format::RGBA16_FLOAT: return 8;
+        case TextureDesc::Format::R32_FLOAT:    return 4;
+        case TextureDesc::Format::RGBA32_FLOAT: return 16;
+    }
+    return 4;
 }
 
 } // namespace kerntopia
\ No newline at end of file
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "ikernel_runner.hpp"
+#include <functional>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 // Vulkan headers conditionally included
 #ifdef KERNTOPIA_VULKAN_SDK_AVAILABLE
@@ -13,6 +17,7 @@ namespace kerntopia {
 
 // Forward declarations
 struct VulkanDevice;
+struct VulkanAllocation;
 
 // Helper functions used by Vulkan memory classes
 #ifdef KERNTOPIA_VULKAN_SDK_AVAILABLE
@@ -29,6 +34,241 @@ extern PFN_vkBindBufferMemory vkBindBufferMemory;
 extern PFN_vkMapMemory vkMapMemory;
 extern PFN_vkUnmapMemory vkUnmapMemory;
 extern PFN_vkGetPhysicalDeviceMemoryProperties vkGetPhysicalDeviceMemoryProperties;
+extern PFN_vkGetBufferDeviceAddress vkGetBufferDeviceAddress;    // Null without VK_KHR_buffer_device_address
+extern PFN_vkGetMemoryHostPointerPropertiesEXT vkGetMemoryHostPointerPropertiesEXT;  // Null without VK_EXT_external_memory_host
+
+// Image functions used by VulkanTexture
+extern PFN_vkGetPhysicalDeviceFormatProperties vkGetPhysicalDeviceFormatProperties;
+extern PFN_vkCreateImage vkCreateImage;
+extern PFN_vkDestroyImage vkDestroyImage;
+extern PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements;
+extern PFN_vkBindImageMemory vkBindImageMemory;
+extern PFN_vkCreateImageView vkCreateImageView;
+extern PFN_vkDestroyImageView vkDestroyImageView;
+
+// Command and queue functions used by the staging ring
+extern PFN_vkCreateCommandPool vkCreateCommandPool;
+extern PFN_vkDestroyCommandPool vkDestroyCommandPool;
+extern PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers;
+extern PFN_vkBeginCommandBuffer vkBeginCommandBuffer;
+extern PFN_vkEndCommandBuffer vkEndCommandBuffer;
+extern PFN_vkCmdCopyBuffer vkCmdCopyBuffer;
+extern PFN_vkCmdCopyBufferToImage vkCmdCopyBufferToImage;
+extern PFN_vkCmdCopyImageToBuffer vkCmdCopyImageToBuffer;
+extern PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier;
+extern PFN_vkQueueSubmit vkQueueSubmit;
+extern PFN_vkCreateFence vkCreateFence;
+extern PFN_vkDestroyFence vkDestroyFence;
+extern PFN_vkWaitForFences vkWaitForFences;
+extern PFN_vkResetFences vkResetFences;
+
+/**
+ * @brief Persistently mapped staging buffer for transfers to and from device-local buffers and images
+ * 
+ * Transfers are split into segment-sized chunks. Each segment has its own command buffer
+ * and fence, so the host fills (or drains) one segment while the copy for the previous
+ * one is still executing on the compute queue. Images are kept in VK_IMAGE_LAYOUT_GENERAL
+ * between transfers so kernels can bind them as storage images without further transitions.
+ * 
+ * Blocking transfers stay on the compute queue so they are ordered with dispatches that use
+ * the same resource. UploadAsync() runs on the dedicated transfer queue when the device has
+ * one and hands off to compute through a semaphore.
+ */
+class VulkanStagingRing {
+public:
+    static constexpr VkDeviceSize kSegmentSize = 4ull * 1024 * 1024;
+    static constexpr uint32_t kSegmentCount = 4;
+    
+    explicit VulkanStagingRing(VulkanDevice* device) : device_(device) {}
+    ~VulkanStagingRing() { Destroy(); }
+    
+    Result<void> Initialize();
+    void Destroy();
+    
+    Result<void> Upload(VkBuffer dst, const void* data, size_t size, size_t offset);
+    Result<void> Download(VkBuffer src, void* data, size_t size, size_t offset);
+    
+    /**
+     * @brief Queue an upload on the transfer queue without waiting for it
+     * 
+     * Nothing orders the copy after earlier dispatches; the caller must ensure none of them
+     * still uses the destination range. @p signal fires once the data is in place, and the
+     * consuming submission must wait on it (the copy records no barrier of its own).
+     */
+    Result<void> UploadAsync(VkBuffer dst, const void* data, size_t size, size_t offset, VkSemaphore signal);
+    /** @brief Wait for every queued transfer and copy out pending readbacks */
+    Result<void> Drain();
+    
+    /** @brief Move a freshly created image from UNDEFINED to GENERAL layout */
+    Result<void> InitializeImage(VkImage image, const VkImageSubresourceRange& range);
+    /** @brief Copy tightly packed texels into one mip level / array layer of an image */
+    Result<void> UploadImage(VkImage dst, const VkImageSubresourceLayers& subresource, VkExtent3D extent,
+                             uint32_t texel_size, const void* data);
+    /** @brief Copy one mip level / array layer of an image into tightly packed host memory */
+    Result<void> DownloadImage(VkImage src, const VkImageSubresourceLayers& subresource, VkExtent3D extent,
+                               uint32_t texel_size, void* data);
+    
+private:
+    struct Segment {
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;        // Buffer being recorded or last submitted
+        VkCommandBuffer compute_commands = VK_NULL_HANDLE;
+        VkCommandBuffer transfer_commands = VK_NULL_HANDLE;     // Same as compute_commands without a transfer queue
+        VkQueue queue = VK_NULL_HANDLE;                         // Queue of the last submission
+        VkFence fence = VK_NULL_HANDLE;
+        bool pending = false;
+        void* readback_dst = nullptr;   // Host destination filled once the fence signals
+        size_t readback_size = 0;
+    };
+    
+    Result<Segment*> BeginSegment(uint32_t& index, bool transfer_queue = false);
+    Result<void> RetireSegment(Segment& segment);
+    Result<void> SubmitSegment(Segment& segment, VkSemaphore signal = VK_NULL_HANDLE);
+    
+    VulkanDevice* device_;
+    VkBuffer buffer_ = VK_NULL_HANDLE;
+    VkDeviceMemory memory_ = VK_NULL_HANDLE;
+    uint8_t* mapped_ = nullptr;
+    VkCommandPool command_pool_ = VK_NULL_HANDLE;
+    VkCommandPool transfer_pool_ = VK_NULL_HANDLE;  // Only with a dedicated transfer queue family
+    Segment segments_[kSegmentCount];
+    uint32_t next_segment_ = 0;
+};
+
+/**
+ * @brief Memory handed out by VulkanMemoryAllocator
+ */
+struct VulkanAllocation {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;            ///< Offset within memory; 0 for dedicated allocations
+    VkDeviceSize size = 0;              ///< Bytes reserved (power-of-two buddy size unless dedicated)
+    VkDeviceSize requested_size = 0;    ///< Bytes the caller asked for
+    void* mapped = nullptr;             ///< Host pointer at offset when the memory type is host visible
+    uint32_t memory_type = 0;
+    bool dedicated = false;             ///< Own vkAllocateMemory call, freed on release
+    void* block = nullptr;              ///< Owning block (allocator internal)
+};
+
+/**
+ * @brief Block-based buddy sub-allocator for buffer and image memory
+ * 
+ * Memory is reserved in kBlockSize blocks per memory type and split into power-of-two
+ * ranges, which keeps every range aligned to its own size. Freed ranges merge with their
+ * buddy and are reused directly; nothing is ever moved. Requests larger than half a block
+ * get a dedicated allocation. Host-visible blocks are mapped once for their lifetime, so
+ * buffers sharing a block can be mapped independently. Optimal-tiling images get their own
+ * blocks so they never neighbour linear resources (bufferImageGranularity).
+ */
+class VulkanMemoryAllocator {
+public:
+    static constexpr VkDeviceSize kBlockSize = 64ull * 1024 * 1024;
+    static constexpr VkDeviceSize kMinAllocation = 256;
+    
+    struct Stats {
+        uint32_t block_count = 0;
+        uint32_t dedicated_count = 0;
+        uint32_t allocation_count = 0;      ///< Live allocations, including dedicated ones
+        VkDeviceSize reserved_bytes = 0;    ///< Device memory held by blocks
+        VkDeviceSize used_bytes = 0;        ///< Buddy ranges handed out from blocks
+        VkDeviceSize requested_bytes = 0;   ///< Bytes callers asked for from blocks (used - requested is rounding waste)
+        VkDeviceSize dedicated_bytes = 0;
+        VkDeviceSize largest_free_bytes = 0;
+        float fragmentation = 0.0f;         ///< 1 - largest free range / total free bytes
+    };
+    
+    explicit VulkanMemoryAllocator(VulkanDevice* device);
+    ~VulkanMemoryAllocator() { Destroy(); }
+    
+    Result<VulkanAllocation> Allocate(const VkMemoryRequirements& requirements, uint32_t memory_type,
+                                      bool optimal_tiling = false);
+    void Free(const VulkanAllocation& allocation);
+    void Destroy();
+    
+    Stats GetStats() const;
+    
+private:
+    struct Block {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        uint32_t memory_type = 0;
+        bool optimal_tiling = false;    ///< Holds optimal-tiling images rather than buffers
+        void* mapped = nullptr;
+        std::vector<std::set<VkDeviceSize>> free_lists;     ///< Free offsets per order (size kMinAllocation << order)
+        std::map<VkDeviceSize, uint32_t> allocated;         ///< Offset -> order
+        VkDeviceSize used = 0;
+    };
+    
+    static uint32_t OrderFor(VkDeviceSize size);
+    void ChainDeviceAddressFlags(VkMemoryAllocateInfo& alloc_info, VkMemoryAllocateFlagsInfo& flags_info) const;
+    Result<Block*> CreateBlock(uint32_t memory_type, bool optimal_tiling);
+    Result<VulkanAllocation> AllocateDedicated(VkDeviceSize size, uint32_t memory_type);
+    void* MapIfHostVisible(VkDeviceMemory memory, uint32_t memory_type, VkDeviceSize size);
+    
+    VulkanDevice* device_;
+    VkPhysicalDeviceMemoryProperties memory_properties_ = {};
+    std::vector<std::unique_ptr<Block>> blocks_;
+    uint32_t dedicated_count_ = 0;
+    VkDeviceSize dedicated_bytes_ = 0;
+    VkDeviceSize requested_bytes_ = 0;
+};
+
+/**
+ * @brief Storage for a completion timeline signal chained into a VkSubmitInfo
+ * 
+ * Must stay alive until the vkQueueSubmit it was attached to returns.
+ */
+struct VulkanTimelineSignal {
+    VkTimelineSemaphoreSubmitInfo info = {};
+    VkSemaphore semaphores[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    uint64_t values[2] = {0, 0};
+};
+
+/**
+ * @brief Vulkan device state shared by the kernel runner and its memory objects
+ */
+struct VulkanDevice {
+    VkPhysicalDevice physical_device = VK_NULL_HANDLE;
+    VkDevice logical_device = VK_NULL_HANDLE;
+    uint32_t compute_queue_family = 0;
+    VkQueue compute_queue = VK_NULL_HANDLE;
+    uint32_t transfer_queue_family = 0;                 ///< Transfer-only family, or compute_queue_family if there is none
+    VkQueue transfer_queue = VK_NULL_HANDLE;            ///< Queue for UploadAsync; compute_queue without a dedicated family
+    std::string device_name;
+    DeviceInfo device_info;
+    
+    VkPhysicalDeviceLimits limits = {};                 ///< Device limits (push constants, alignments, ranges)
+    bool unified_memory = false;                        ///< Device-local memory is host visible (integrated/CPU devices)
+    std::unique_ptr<VulkanStagingRing> staging_ring;    ///< Created on the first device-local transfer
+    std::unique_ptr<VulkanMemoryAllocator> allocator;   ///< Created on the first buffer or image allocation
+    float upload_time_ms = 0.0f;                        ///< Host-to-device transfer time not yet reported
+    float download_time_ms = 0.0f;                      ///< Device-to-host transfer time not yet reported
+    VkSemaphore completion_timeline = VK_NULL_HANDLE;   ///< Signaled by compute-queue submits; null without timeline semaphores
+    uint64_t completion_token = 0;                      ///< Token of the latest compute-queue submit
+    bool buffer_device_address = false;                 ///< VK_KHR_buffer_device_address enabled; buffers expose GPU addresses
+    bool external_memory_host = false;                  ///< VK_EXT_external_memory_host enabled; host allocations can back buffers
+    VkDeviceSize host_import_alignment = 0;             ///< minImportedHostPointerAlignment for host pointer imports
+    std::function<Result<bool>(uint64_t token)> await_token;  ///< Set by the runner; blocks until a completion token is reached
+    
+    bool HasTransferQueue() const { return transfer_queue_family != compute_queue_family; }
+    
+    /**
+     * @brief Prepare the completion token of a compute-queue submit
+     * 
+     * With a timeline semaphore the submit is extended to signal it with the returned token,
+     * keeping any binary signal it already has. Store the token in completion_token once
+     * vkQueueSubmit succeeds.
+     * 
+     * @param submit Submit info to extend (its pNext must be empty)
+     * @param signal Storage for the chained structures
+     * @return Token the submit completes
+     */
+    uint64_t AttachCompletionSignal(VkSubmitInfo& submit, VulkanTimelineSignal& signal) const;
+    
+    /**
+     * @brief Wait until every compute-queue submit issued so far has completed
+     * 
+     * Host-visible buffers call this before touching mapped memory a pending dispatch may use.
+     */
+    Result<void> AwaitIssuedWork() const;
+};
 #endif
 
 /**
@@ -37,6 +277,14 @@ extern PFN_vkGetPhysicalDeviceMemoryProperties vkGetPhysicalDeviceMemoryProperti
 class VulkanBuffer : public IBuffer {
 public:
     VulkanBuffer(VulkanDevice* device, size_t size, Type type, Usage usage);
+    
+    /**
+     * @brief Back the buffer with caller-owned host memory (VK_EXT_external_memory_host)
+     * 
+     * @p host_pointer must be page aligned; the pages covering @p size bytes are imported.
+     * Check GetBuffer() for success.
+     */
+    VulkanBuffer(VulkanDevice* device, void* host_pointer, size_t size, Type type);
     ~VulkanBuffer();
     
     size_t GetSize() const override { return size_; }
@@ -47,10 +295,22 @@ public:
     
     Result<void> UploadData(const void* data, size_t size, size_t offset = 0) override;
     Result<void> DownloadData(void* data, size_t size, size_t offset = 0) override;
+    uint64_t GetDeviceAddress() const override { return device_address_; }
+    
+    /**
+     * @brief Upload without blocking, signaling @p signal (a VkSemaphore) once the data is visible to the device
+     * 
+     * Device-local buffers go through VulkanStagingRing::UploadAsync; host-visible buffers are
+     * written directly and the semaphore is signaled by an empty compute-queue submission.
+     */
+    Result<void> UploadAsync(const void* data, size_t size, size_t offset, void* signal);
     
     // Vulkan-specific methods  
     void* GetBuffer() const { return reinterpret_cast<void*>(buffer_); }
     void* GetDeviceMemory() const { return reinterpret_cast<void*>(device_memory_); }
+    size_t GetMemoryOffset() const;
+    bool IsDeviceLocal() const { return device_local_; }
+    bool IsHostImport() const { return host_pointer_ != nullptr; }
     void DestroyBuffer();
     
 private:
@@ -58,19 +318,28 @@ private:
     size_t size_;
     Type type_;
     Usage usage_;
+    bool device_local_ = false;   // Not host visible - transfers go through the staging ring
+    uint64_t device_address_ = 0; // vkGetBufferDeviceAddress result, 0 without VK_KHR_buffer_device_address
     
     // Vulkan handles (stored as void* for header compatibility, cast to VkBuffer/VkDeviceMemory in implementation)
     void* buffer_ = nullptr;
     void* device_memory_ = nullptr;
+    std::unique_ptr<VulkanAllocation> allocation_;  // Range of device_memory_ owned by this buffer
+    void* host_pointer_ = nullptr;                  // Imported host allocation; device_memory_ is then its own import
     
     void* mapped_ptr_ = nullptr;
     bool is_mapped_ = false;
     
     bool CreateBuffer();
+    bool ImportHostMemory(void* host_pointer);
 };
 
 /**
  * @brief Vulkan texture implementation
+ * 
+ * Backed by an optimal-tiling VkImage in device-local memory and kept in GENERAL layout, so the
+ * same view serves storage-image and sampled-image bindings. Cube textures are stored as six
+ * array layers per cube and viewed as a 2D array, which is how compute kernels address them.
  */
 class VulkanTexture : public ITexture {
 public:
@@ -86,19 +355,24 @@ public:
     void* GetImage() const { return reinterpret_cast<void*>(image_); }
     void* GetImageView() const { return reinterpret_cast<void*>(image_view_); }
     void* GetDeviceMemory() const { return reinterpret_cast<void*>(device_memory_); }
+    bool IsStorage() const { return storage_; }
+    void DestroyImage();
     
 private:
     VulkanDevice* device_;
     TextureDesc desc_;
+    uint32_t layer_count_ = 1;    // Image array layers (six per cube for cube textures)
+    bool storage_ = false;        // Created with VK_IMAGE_USAGE_STORAGE_BIT
     
     // Vulkan handles (stored as void* for header compatibility, cast to VkImage/VkImageView/VkDeviceMemory in implementation)
     void* image_ = nullptr;
     void* image_view_ = nullptr;
     void* device_memory_ = nullptr;
+    std::unique_ptr<VulkanAllocation> allocation_;  // Range of device_memory_ owned by this image
     
     bool CreateImage();
-    void DestroyImage();
     uint32_t GetVulkanFormat() const;
+    uint32_t GetTexelSize() const;
 };
 
 } // namespace kerntopia
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "ikernel_runner.hpp"
 #include "vulkan_memory.hpp"
+#include "spirv_reflection.hpp"
 #include <chrono>
 #include <map>
 
@@ -13,6 +14,13 @@ struct VulkanDevice;
 struct VulkanComputePipeline;
 struct VulkanCommandPool;
 struct VulkanQueryPool;
+struct VulkanPipelineCache;
+struct VulkanLayoutCache;
+struct VulkanPipelineVariants;
+struct VulkanDescriptorCache;
+struct VulkanReplay;
+struct VulkanCommandList;
+struct VulkanPipelinedRun;
 
 // Memory classes are now defined in vulkan_memory.hpp
 
@@ -30,14 +38,27 @@ public:
     DeviceInfo GetDeviceInfo() const override;
     
     Result<void> LoadKernel(const std::vector<uint8_t>& bytecode, const std::string& entry_point) override;
+    Result<void> SetSpecialization(const KernelSpecialization& specialization) override;
     Result<void> SetParameters(const void* params, size_t size) override;
     Result<void> SetBuffer(int binding, std::shared_ptr<IBuffer> buffer) override;
     Result<void> SetTexture(int binding, std::shared_ptr<ITexture> texture) override;
     Result<void> Dispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
     Result<void> WaitForCompletion() override;
+    Result<void> RecordDispatch(uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
+    Result<void> ReplayRecorded(uint32_t iterations) override;
+    Result<void> BeginCommandList() override;
+    Result<void> RecordBarrier() override;
+    Result<void> SubmitCommandList() override;
+    Result<void> DispatchPipelined(std::shared_ptr<IBuffer> input, const std::vector<const void*>& frames,
+                                   size_t frame_size, uint32_t groups_x, uint32_t groups_y, uint32_t groups_z) override;
+    uint64_t GetCompletionToken() const override;
+    Result<bool> IsTokenComplete(uint64_t token) override;
+    Result<void> WaitForToken(uint64_t token) override;
+    Result<void> SetCounterCollection(bool enable) override;
     TimingResults GetLastExecutionTime() override;
     Result<std::shared_ptr<IBuffer>> CreateBuffer(size_t size, IBuffer::Type type, IBuffer::Usage usage) override;
     Result<std::shared_ptr<ITexture>> CreateTexture(const TextureDesc& desc) override;
+    Result<std::shared_ptr<IBuffer>> WrapHostMemory(void* host_pointer, size_t size, IBuffer::Type type) override;
     void CalculateDispatchSize(uint32_t width, uint32_t height, uint32_t depth,
                               uint32_t& groups_x, uint32_t& groups_y, uint32_t& groups_z) override;
     std::string GetDebugInfo() const override;
@@ -50,24 +71,65 @@ private:
     std::unique_ptr<VulkanComputePipeline> pipeline_;
     std::unique_ptr<VulkanCommandPool> command_pool_;
     std::unique_ptr<VulkanQueryPool> query_pool_;
+    std::unique_ptr<VulkanPipelineCache> pipeline_cache_;
+    std::unique_ptr<VulkanLayoutCache> layout_cache_;
+    std::unique_ptr<VulkanPipelineVariants> pipeline_variants_;
+    std::unique_ptr<VulkanDescriptorCache> descriptor_cache_;
+    std::unique_ptr<VulkanReplay> replay_;
+    std::unique_ptr<VulkanCommandList> command_list_;
+    std::unique_ptr<VulkanPipelinedRun> pipelined_;
     
     // Resource bindings
     std::map<int, std::shared_ptr<IBuffer>> bound_buffers_;
     std::map<int, std::shared_ptr<ITexture>> bound_textures_;
     std::vector<uint8_t> parameter_data_;
+    bool parameters_dirty_ = false;                 // SetParameters data not yet applied to a dispatch
+    std::shared_ptr<VulkanBuffer> uniform_ring_;    // Host-visible ring for parameters when there are no push constants
+    size_t uniform_ring_head_ = 0;
+    size_t parameter_range_ = 0;                    // Descriptor range written for the ring binding
+    uint32_t parameter_offset_ = 0;                 // Dynamic offset of the current parameters in uniform_ring_
+    int parameter_binding_ = -1;                    // Uniform binding fed from uniform_ring_, -1 if none
     std::string entry_point_; // Store shader entry point for pipeline creation
+    SpirvReflection reflection_; // Resource interface of the loaded kernel (local_size is the specialized size)
+    KernelSpecialization specialization_; // Applied by the next LoadKernel
+    bool descriptors_dirty_ = true; // Bindings changed since a descriptor set was last chosen
     
-    // Timing
+    // Timing (dispatch_start_ is taken at vkQueueSubmit, dispatch_end_ once WaitForCompletion observes the fence)
     std::chrono::high_resolution_clock::time_point dispatch_start_;
     std::chrono::high_resolution_clock::time_point dispatch_end_;
     TimingResults last_timing_;
+    uint32_t completed_iterations_ = 1; // Dispatches covered by the most recently retired submission
     
     bool InitializeVulkan(const DeviceInfo& device_info);
     void ShutdownVulkan();
     Result<void> CreateComputePipeline();
+    Result<void> AcquirePipelineLayout();
+    Result<void> ResolveSpecialization(const std::vector<uint8_t>& bytecode, SpirvReflection& reflection,
+                                       std::vector<uint8_t>& patched_bytecode);
+    void OpenPipelineCache(const std::vector<uint8_t>& bytecode);
+    void SavePipelineCache();
     Result<void> CreateDescriptorSets();
     Result<void> UpdateDescriptorSets();
+    Result<void> AcquireDescriptorSet();
+    Result<void*> AllocateDescriptorSet();   // VkDescriptorSet
+    void ResetDescriptorCache();
     Result<void> EnsureCommandBuffer();
+    Result<void> PrepareParameters();
+    Result<void> PrepareDispatch();
+    void RecordDispatchCommands(void* command_buffer, uint32_t groups_x, uint32_t groups_y, uint32_t groups_z);
+    Result<void> InvalidateRecording();
+    Result<void> EnsureReplayTimestamps(uint32_t count);
+    bool IsRecordingCommandList() const;
+    void RetireForCommandList();
+    void DestroyRetiredPipelines();
+    Result<void> EnsurePipelinedResources(size_t frame_size);
+    Result<void> SubmitPipelinedFrame(uint32_t slot, void* input_buffer, size_t frame_size, bool wait_upload, bool dispatch,
+                                      uint32_t groups_x, uint32_t groups_y, uint32_t groups_z);
+    Result<void> WaitPipelinedSlot(uint32_t slot);
+    void DestroyPipelinedResources();
+    Result<void> RetireSubmissions(bool wait_all);
+    Result<bool> AwaitToken(uint64_t token, uint64_t timeout_ns);
+    void ReleaseQuerySlot(uint32_t slot);
 };
 
 /**
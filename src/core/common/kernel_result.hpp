@@ -4,6 +4,7 @@
 #include <chrono>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace kerntopia {
 
@@ -15,6 +16,13 @@ struct TimingResults {
     float compute_time_ms = 0.0f;           ///< Pure kernel execution time  
     float memory_teardown_time_ms = 0.0f;   ///< Time to read back results and cleanup
     float total_time_ms = 0.0f;             ///< Total end-to-end time
+    float device_time_ms = 0.0f;            ///< Kernel time measured on the device (0 if unavailable)
+    float host_submit_overhead_ms = 0.0f;   ///< Host-observed time not spent executing on the device
+    float pipeline_creation_time_ms = 0.0f; ///< Driver compile time when the kernel was loaded (cold vs. cached)
+    std::vector<float> iteration_times_ms;  ///< Per-iteration device times of a replayed dispatch (empty otherwise)
+    std::vector<float> dispatch_times_ms;   ///< Per-dispatch device times of a submitted command list (empty otherwise)
+    float transfer_overlap = 0.0f;          ///< Share of the shorter of upload/compute hidden by a pipelined run (0 = serial, 1 = fully hidden)
+    std::map<std::string, double> counters; ///< Device counters of the last completed dispatch (empty unless counter collection is on)
     
     std::chrono::steady_clock::time_point start_time;
     std::chrono::steady_clock::time_point end_time;
@@ -109,11 +117,38 @@ struct KernelResult {
     }
 };
 
+/**
+ * @brief Distribution of one timing phase across the samples of a performance run
+ */
+struct TimingDistribution {
+    std::vector<float> samples_ms;          ///< Raw samples in execution order, for re-analysis downstream
+    float mean_ms = 0.0f;
+    float std_deviation_ms = 0.0f;          ///< Population standard deviation
+    float min_ms = 0.0f;
+    float max_ms = 0.0f;
+    float p50_ms = 0.0f;                    ///< Percentiles interpolate linearly between order statistics
+    float p90_ms = 0.0f;
+    float p99_ms = 0.0f;
+    float p999_ms = 0.0f;
+    
+    // Outliers: modified z-score 0.6745 * |x - median| / MAD above 3.5 (none are flagged when MAD is 0)
+    float mad_ms = 0.0f;                    ///< Median absolute deviation from the median
+    std::vector<size_t> outlier_indices;    ///< Indices into samples_ms
+    
+    // Percentile bootstrap 95% confidence intervals
+    float mean_ci_low_ms = 0.0f;
+    float mean_ci_high_ms = 0.0f;
+    float median_ci_low_ms = 0.0f;
+    float median_ci_high_ms = 0.0f;
+};
+
 /**
  * @brief Statistical summary for multiple kernel executions
  */
 struct StatisticalSummary {
-    size_t sample_count = 0;
+    size_t warmup_count = 0;                ///< Iterations run before sampling, excluded from the statistics
+    size_t sample_count = 0;                ///< Measured iterations
+    bool cv_target_met = false;             ///< Adaptive sampling stopped on the CV target rather than the time budget
     float mean_time_ms = 0.0f;
     float std_deviation_ms = 0.0f;
     float min_time_ms = 0.0f;
@@ -121,6 +156,17 @@ struct StatisticalSummary {
     float median_time_ms = 0.0f;
     float coefficient_of_variation = 0.0f;
     
+    // Per-iteration distributions; the scalar fields above summarize compute
+    TimingDistribution compute;             ///< TimingResults::compute_time_ms
+    TimingDistribution memory_setup;        ///< TimingResults::memory_setup_time_ms
+    TimingDistribution memory_teardown;     ///< TimingResults::memory_teardown_time_ms
+    TimingDistribution total;               ///< TimingResults::total_time_ms
+    
+    // Phase timings: setup and teardown run once around the sampled iterations
+    float setup_time_ms = 0.0f;             ///< Runner creation, kernel load, input preparation and device allocation
+    float mean_transfer_time_ms = 0.0f;     ///< Mean per-iteration upload plus readback time
+    float teardown_time_ms = 0.0f;          ///< Release of everything setup created
+    
     // Performance metrics
     float mean_gflops = 0.0f;
     float mean_bandwidth_gbps = 0.0f;
@@ -13,7 +13,7 @@ namespace kerntopia {
 enum class Backend {
     CUDA,       ///< NVIDIA CUDA backend
     VULKAN,     ///< Vulkan compute backend
-    CPU,        ///< CPU fallback (via Vulkan llvmpipe)
+    CPU,        ///< Native CPU execution of Slang kernels compiled to host code, or software Vulkan (lavapipe, SwiftShader)
     DX12        ///< DirectX 12 compute (future)
 };
 
@@ -57,6 +57,7 @@ enum class SlangProfile {
     CUDA_SM_7_0,  ///< CUDA Compute Capability 7.0 (GTX 1650+, RTX 20xx+) 
     CUDA_SM_8_0,  ///< CUDA Compute Capability 8.0 (RTX 4060+)
     HLSL_6_0,     ///< HLSL 6.0 for DirectX 12 (future)
+    HOST,         ///< Host CPU code for the CPU backend
     DEFAULT       ///< Auto-select based on backend
 };
 
@@ -68,6 +69,7 @@ enum class SlangTarget {
     PTX,          ///< PTX assembly for CUDA  
     GLSL,         ///< GLSL source code
     HLSL,         ///< HLSL source code (future)
+    SHADER_SHAREDLIB, ///< Host-callable shared library for the CPU backend
     AUTO          ///< Auto-select based on backend
 };
 
@@ -89,6 +91,10 @@ struct TestConfiguration {
     TestMode mode = TestMode::FUNCTIONAL;
     int iterations = 1;
     float timeout_seconds = 60.0f;
+    int warmup_iterations = 1;              ///< Performance runs discard this many iterations before sampling
+    bool adaptive_sampling = false;         ///< Keep sampling past iterations until the rolling CV settles
+    float target_cv = 0.02f;                ///< Adaptive sampling stops once the rolling CV is at or below this
+    float sampling_budget_ms = 5000.0f;     ///< Adaptive sampling stops once this much time went into samples
     
     // SLANG compilation parameters
     SlangProfile slang_profile = SlangProfile::DEFAULT;
@@ -111,6 +117,7 @@ struct TestConfiguration {
     std::string output_path;
     bool save_intermediates = false;
     std::string temp_dir = "./temp";
+    bool collect_counters = false;          ///< Collect device counters (e.g. shader invocations) per dispatch
     
     // Kernel-specific parameters (flexible key-value store)
     std::map<std::string, float> float_params;
@@ -167,6 +174,7 @@ struct TestConfiguration {
             case SlangProfile::CUDA_SM_7_0: return "cuda_sm_7_0";
             case SlangProfile::CUDA_SM_8_0: return "cuda_sm_8_0";
             case SlangProfile::HLSL_6_0: return "hlsl_6_0";
+            case SlangProfile::HOST: return "host";
             case SlangProfile::DEFAULT: return GetDefaultSlangProfile();
             default: return "unknown";
         }
@@ -183,6 +191,7 @@ struct TestConfiguration {
             case SlangTarget::PTX: return "ptx";
             case SlangTarget::GLSL: return "glsl";
             case SlangTarget::HLSL: return "hlsl";
+            case SlangTarget::SHADER_SHAREDLIB: return "shader-sharedlib";
             case SlangTarget::AUTO: return GetDefaultSlangTarget();
             default: return "unknown";
         }
@@ -205,15 +214,21 @@ struct TestConfiguration {
      * @brief Get compiled kernel filename
      * 
      * @param kernel_name Base kernel name (e.g., "conv2d")
-     * @return Compiled kernel filename (e.g., "conv2d-cuda_sm_7_0.ptx", "conv2d-glsl_450.spirv")
+     * @return Compiled kernel filename (e.g., "conv2d-cuda_sm_7_0.ptx", "conv2d-glsl_450.spirv", "conv2d-host.so")
      */
     std::string GetCompiledKernelFilename(const std::string& kernel_name) const {
         std::string profile = GetSlangProfileName();
         std::string target = GetSlangTargetName();
+#ifdef _WIN32
+        const std::string sharedlib_extension = "dll";
+#else
+        const std::string sharedlib_extension = "so";
+#endif
         std::string extension = (target == "spirv") ? "spirv" : 
-                               (target == "ptx") ? "ptx" : target;
+                               (target == "ptx") ? "ptx" :
+                               (target == "shader-sharedlib") ? sharedlib_extension : target;
         
-        // Simplified naming: conv2d-cuda_sm_7_0.ptx, conv2d-glsl_450.spirv
+        // Simplified naming: conv2d-cuda_sm_7_0.ptx, conv2d-glsl_450.spirv, conv2d-host.so
         return kernel_name + "-" + profile + "." + extension;
     }
     
@@ -223,8 +238,8 @@ private:
      */
     std::string GetDefaultSlangProfile() const {
         switch (target_backend) {
-            case Backend::VULKAN:
-            case Backend::CPU: return "glsl_450";
+            case Backend::VULKAN: return "glsl_450";
+            case Backend::CPU: return "host";
             case Backend::CUDA: return "cuda_sm_7_0";
             case Backend::DX12: return "hlsl_6_0";
             default: return "glsl_450";
@@ -236,8 +251,8 @@ private:
      */
     std::string GetDefaultSlangTarget() const {
         switch (target_backend) {
-            case Backend::VULKAN:
-            case Backend::CPU: return "spirv";
+            case Backend::VULKAN: return "spirv";
+            case Backend::CPU: return "shader-sharedlib";
             case Backend::CUDA: return "ptx";
             case Backend::DX12: return "hlsl";
             default: return "spirv";
@@ -12,6 +12,7 @@
 #include <iomanip>
 #include <sstream>
 #include <algorithm>
+#include <thread>
 
 // Include Vulkan headers for enhanced detection - ONLY if SDK is available
 #ifdef KERNTOPIA_VULKAN_SDK_AVAILABLE
@@ -191,6 +192,20 @@ Result<void*> SystemInterrogator::GetVulkanLibraryHandle() {
     return KERNTOPIA_SUCCESS(cached_vulkan_library_handle_);
 }
 
+uint32_t SystemInterrogator::GetLavapipeThreadCount() {
+    const char* lp_num_threads = std::getenv("LP_NUM_THREADS");
+    if (lp_num_threads && *lp_num_threads) {
+        char* end = nullptr;
+        unsigned long requested = std::strtoul(lp_num_threads, &end, 10);
+        if (*end == '\0') {
+            // 0 keeps lavapipe on the submitting thread, which is still one thread doing the work
+            return static_cast<uint32_t>(std::max<unsigned long>(requested, 1));
+        }
+        KERNTOPIA_LOG_WARNING(LogComponent::SYSTEM, "Ignoring invalid LP_NUM_THREADS value: " + std::string(lp_num_threads));
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
 RuntimeInfo SystemInterrogator::DetectCudaRuntime() {
     RuntimeInfo info;
     info.name = "CUDA";
@@ -298,7 +313,7 @@ RuntimeInfo SystemInterrogator::DetectCudaRuntime() {
         info.capabilities.precompiled_kernels = true;
         info.capabilities.memory_management = true;
         info.capabilities.device_enumeration = true;
-        info.capabilities.performance_counters = true;
+        info.capabilities.performance_counters = false;  // Device counters would need CUPTI
         info.capabilities.supported_targets = {"ptx", "cubin"};
         info.capabilities.supported_profiles = {"cuda_sm_6_0", "cuda_sm_7_0", "cuda_sm_7_5", "cuda_sm_8_0", "cuda_sm_8_9"};
         info.capabilities.supported_stages = {"compute"};
@@ -442,7 +457,6 @@ RuntimeInfo SystemInterrogator::DetectVulkanRuntime() {
     info.capabilities.precompiled_kernels = true;
     info.capabilities.memory_management = true;
     info.capabilities.device_enumeration = true;
-    info.capabilities.performance_counters = true;
     info.capabilities.supported_targets = {"spirv"};
     info.capabilities.supported_profiles = {"glsl_450", "glsl_460"};
     info.capabilities.supported_stages = {"compute", "vertex", "fragment"};
@@ -452,6 +466,8 @@ RuntimeInfo SystemInterrogator::DetectVulkanRuntime() {
     
     // Enumerate devices
     info.devices = EnumerateVulkanDevices(info);
+    info.capabilities.performance_counters = std::any_of(info.devices.begin(), info.devices.end(),
+                                                         [](const DeviceInfo& device) { return device.supports_counters; });
     
     KERNTOPIA_LOG_DEBUG(LogComponent::SYSTEM, "Vulkan runtime detection complete: " + selected_library);
     return info;
@@ -938,6 +954,8 @@ std::vector<DeviceInfo> SystemInterrogator::EnumerateVulkanDevices(const Runtime
         vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties"));
     PFN_vkGetPhysicalDeviceQueueFamilyProperties vkGetPhysicalDeviceQueueFamilyProperties = reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties>(
         vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties"));
+    PFN_vkGetPhysicalDeviceFeatures vkGetPhysicalDeviceFeatures = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures>(
+        vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures"));
     
     KERNTOPIA_LOG_DEBUG(LogComponent::SYSTEM, "Instance-level function pointers loaded:");
     KERNTOPIA_LOG_DEBUG(LogComponent::SYSTEM, "  vkEnumeratePhysicalDevices: " + 
@@ -946,7 +964,7 @@ std::vector<DeviceInfo> SystemInterrogator::EnumerateVulkanDevices(const Runtime
                        std::to_string(reinterpret_cast<uintptr_t>(vkGetPhysicalDeviceProperties)));
     
     if (!vkEnumeratePhysicalDevices || !vkGetPhysicalDeviceProperties || 
-        !vkGetPhysicalDeviceMemoryProperties || !vkGetPhysicalDeviceQueueFamilyProperties) {
+        !vkGetPhysicalDeviceMemoryProperties || !vkGetPhysicalDeviceQueueFamilyProperties || !vkGetPhysicalDeviceFeatures) {
         KERNTOPIA_LOG_ERROR(LogComponent::SYSTEM, "Failed to get required Vulkan device functions");
         vkDestroyInstance(instance, nullptr);
         return devices;
@@ -995,6 +1013,7 @@ std::vector<DeviceInfo> SystemInterrogator::EnumerateVulkanDevices(const Runtime
         DeviceInfo device_info;
         device_info.name = device_props.deviceName;
         device_info.backend_type = Backend::VULKAN;
+        device_info.device_id = static_cast<int>(i);  // Physical device index the runner selects
         
         // Calculate total memory from all device-local heaps
         uint64_t total_memory = 0;
@@ -1017,6 +1036,21 @@ std::vector<DeviceInfo> SystemInterrogator::EnumerateVulkanDevices(const Runtime
                                ", DID: 0x" + std::to_string(device_props.deviceID) + ")";
         }
         
+        // Pipeline statistics queries count compute shader invocations
+        VkPhysicalDeviceFeatures features = {};
+        vkGetPhysicalDeviceFeatures(physical_device, &features);
+        device_info.supports_counters = features.pipelineStatisticsQuery == VK_TRUE;
+        
+        // Software implementations (lavapipe, SwiftShader) run on the host and are also offered
+        // under the CPU backend. lavapipe sizes its pool from LP_NUM_THREADS, SwiftShader uses every core.
+        if (device_props.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU) {
+            device_info.backend_type = Backend::CPU;
+            device_info.is_integrated = true;
+            bool is_lavapipe = std::string(device_props.deviceName).find("llvmpipe") != std::string::npos;
+            device_info.multiprocessor_count = is_lavapipe ? GetLavapipeThreadCount()
+                                                           : std::max(1u, std::thread::hardware_concurrency());
+        }
+        
         // Find compute queue family
         bool has_compute = false;
         for (uint32_t j = 0; j < queue_family_count; ++j) {
@@ -1032,7 +1066,9 @@ std::vector<DeviceInfo> SystemInterrogator::EnumerateVulkanDevices(const Runtime
             
             KERNTOPIA_LOG_DEBUG(LogComponent::SYSTEM, 
                 "Device " + std::to_string(i) + ": " + device_info.name + 
-                " (" + std::to_string(total_memory / (1024*1024)) + " MB)");
+                " (" + std::to_string(total_memory / (1024*1024)) + " MB" +
+                (device_info.backend_type == Backend::CPU
+                     ? ", software, " + std::to_string(device_info.multiprocessor_count) + " threads" : "") + ")");
         } else {
             KERNTOPIA_LOG_WARNING(LogComponent::SYSTEM, 
                 "Device " + std::to_string(i) + " (" + device_info.name + ") has no compute queues, skipping");
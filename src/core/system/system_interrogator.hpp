@@ -102,6 +102,17 @@ public:
      * @return Library handle or error if Vulkan not loaded
      */
     static Result<void*> GetVulkanLibraryHandle();
+    
+    /**
+     * @brief Get the thread count lavapipe runs with
+     * 
+     * Reads LP_NUM_THREADS, the variable lavapipe sizes its thread pool from, and falls back
+     * to the hardware concurrency when unset. Only describes lavapipe devices; the native CPU
+     * runner has its own KERNTOPIA_CPU_THREADS.
+     * 
+     * @return Thread count (at least 1)
+     */
+    static uint32_t GetLavapipeThreadCount();
 
 private:
     SystemInterrogator() = default;
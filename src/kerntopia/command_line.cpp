@@ -3,6 +3,7 @@
 #include <sstream>
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 
 namespace kerntopia {
 
@@ -93,6 +94,19 @@ bool CommandLineParser::ParseOptions(int argc, char* argv[]) {
         else if (arg == "--precompiled") {
             test_config_.compilation_mode = CompilationMode::PRECOMPILED;
         }
+        else if (arg == "--counters") {
+            test_config_.collect_counters = true;
+        }
+        else if (arg == "--adaptive") {
+            test_config_.adaptive_sampling = true;
+        }
+        else if (arg == "--warmup" || arg == "--target-cv" || arg == "--time-budget") {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: " << arg << " requires argument\n";
+                return false;
+            }
+            if (!ParseSampling(arg, argv[++i])) return false;
+        }
         else if (arg == "--device" || arg == "-d") {
             if (i + 1 >= argc) {
                 std::cerr << "Error: --device requires argument\n";
@@ -152,8 +166,10 @@ bool CommandLineParser::ParseProfile(const std::string& profile_str) {
         test_config_.slang_profile = SlangProfile::CUDA_SM_8_0;
     } else if (profile_str == "hlsl_6_0") {
         test_config_.slang_profile = SlangProfile::HLSL_6_0;
+    } else if (profile_str == "host") {
+        test_config_.slang_profile = SlangProfile::HOST;
     } else {
-        std::cerr << "Error: Unknown profile '" << profile_str << "'. Valid options: glsl_450, cuda_sm_6_0, cuda_sm_7_0, cuda_sm_8_0, hlsl_6_0\n";
+        std::cerr << "Error: Unknown profile '" << profile_str << "'. Valid options: glsl_450, cuda_sm_6_0, cuda_sm_7_0, cuda_sm_8_0, hlsl_6_0, host\n";
         return false;
     }
     return true;
@@ -168,8 +184,10 @@ bool CommandLineParser::ParseTarget(const std::string& target_str) {
         test_config_.slang_target = SlangTarget::GLSL;
     } else if (target_str == "hlsl") {
         test_config_.slang_target = SlangTarget::HLSL;
+    } else if (target_str == "shader-sharedlib") {
+        test_config_.slang_target = SlangTarget::SHADER_SHAREDLIB;
     } else {
-        std::cerr << "Error: Unknown target '" << target_str << "'. Valid options: spirv, ptx, glsl, hlsl\n";
+        std::cerr << "Error: Unknown target '" << target_str << "'. Valid options: spirv, ptx, glsl, hlsl, shader-sharedlib\n";
         return false;
     }
     return true;
@@ -187,6 +205,47 @@ bool CommandLineParser::ParseMode(const std::string& mode_str) {
     return true;
 }
 
+bool CommandLineParser::ParseSampling(const std::string& option, const std::string& value_str) {
+    try {
+        // The whole value must be a number; "5x" or "0.05%" are rejected rather than truncated
+        size_t consumed = 0;
+        if (option == "--warmup") {
+            int warmup = std::stoi(value_str, &consumed);
+            if (consumed != value_str.size()) {
+                std::cerr << "Error: Invalid value '" << value_str << "' for " << option << "\n";
+                return false;
+            }
+            if (warmup < 0) {
+                std::cerr << "Error: Warm-up iterations must be non-negative\n";
+                return false;
+            }
+            test_config_.warmup_iterations = warmup;
+            return true;
+        }
+        
+        float value = std::stof(value_str, &consumed);
+        if (consumed != value_str.size()) {
+            std::cerr << "Error: Invalid value '" << value_str << "' for " << option << "\n";
+            return false;
+        }
+        if (!std::isfinite(value) || value <= 0.0f) {
+            std::cerr << "Error: " << option << " must be a positive number\n";
+            return false;
+        }
+        if (option == "--target-cv") {
+            test_config_.target_cv = value / 100.0f;  // Given in percent
+        } else {
+            test_config_.sampling_budget_ms = value;
+        }
+        test_config_.adaptive_sampling = true;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: Invalid value '" << value_str << "' for " << option << "\n";
+        return false;
+    }
+    
+    return true;
+}
+
 bool CommandLineParser::ParseDevice(const std::string& device_str) {
     // Check if backend has been specified first
     if (!backend_specified_) {
@@ -216,9 +275,11 @@ void CommandLineParser::SetDefaultProfileTarget() {
     if (test_config_.slang_profile == SlangProfile::DEFAULT) {
         switch (test_config_.target_backend) {
             case Backend::VULKAN:
-            case Backend::CPU:
                 test_config_.slang_profile = SlangProfile::GLSL_450;
                 break;
+            case Backend::CPU:
+                test_config_.slang_profile = SlangProfile::HOST;
+                break;
             case Backend::CUDA:
                 test_config_.slang_profile = SlangProfile::CUDA_SM_7_0;
                 break;
@@ -231,9 +292,11 @@ void CommandLineParser::SetDefaultProfileTarget() {
     if (test_config_.slang_target == SlangTarget::AUTO) {
         switch (test_config_.target_backend) {
             case Backend::VULKAN:
-            case Backend::CPU:
                 test_config_.slang_target = SlangTarget::SPIRV;
                 break;
+            case Backend::CPU:
+                test_config_.slang_target = SlangTarget::SHADER_SHAREDLIB;
+                break;
             case Backend::CUDA:
                 test_config_.slang_target = SlangTarget::PTX;
                 break;
@@ -310,10 +373,16 @@ std::string CommandLineParser::GetHelpText() const {
     ss << "  --profile, -p <profile>     SLANG profile:\n";
     ss << "                                cuda: cuda_sm_6_0, cuda_sm_7_0, cuda_sm_8_0\n";
     ss << "                                vulkan: glsl_450\n";
-    ss << "  --target, -t <target>       Compilation target: spirv, ptx, glsl, hlsl\n";
+    ss << "                                cpu: host\n";
+    ss << "  --target, -t <target>       Compilation target: spirv, ptx, glsl, hlsl, shader-sharedlib\n";
     ss << "  --mode, -m <mode>           Test mode: functional, performance\n";
     ss << "  --jit                       Use just-in-time compilation (NOT IMPLEMENTED)\n";
-    ss << "  --precompiled               Use precompiled kernels (default)\n\n";
+    ss << "  --precompiled               Use precompiled kernels (default)\n";
+    ss << "  --counters                  Collect device counters per dispatch (Vulkan pipeline statistics)\n";
+    ss << "  --warmup <n>                Discarded iterations before performance sampling (default 1)\n";
+    ss << "  --adaptive                  Sample until the rolling CV settles instead of a fixed count\n";
+    ss << "  --target-cv <percent>       Adaptive CV target (default 2; implies --adaptive)\n";
+    ss << "  --time-budget <ms>          Adaptive sampling time limit (default 5000; implies --adaptive)\n\n";
     
     ss << "GLOBAL OPTIONS:\n";
     ss << "  --verbose, -v               Verbose output\n";
@@ -388,9 +457,12 @@ std::string CommandLineParser::GetRunHelpText() const {
     ss << "  --backend, -b <name>     Choose backend: cuda, vulkan, cpu\n";
     ss << "  --device, -d <id>        Device ID (0, 1, 2...) - use after --backend\n";
     ss << "  --profile, -p <profile>  SLANG profile for compilation\n";
-    ss << "  --target, -t <target>    Output format: spirv, ptx, glsl, hlsl\n";
+    ss << "  --target, -t <target>    Output format: spirv, ptx, glsl, hlsl, shader-sharedlib\n";
     ss << "  --mode, -m <mode>        Test type: functional, performance\n";
     ss << "  --jit                    Compile at runtime (NOT IMPLEMENTED)\n";
+    ss << "  --counters               Report device counters (Vulkan shader invocations)\n";
+    ss << "  --warmup <n>             Warm-up iterations excluded from statistics (default 1)\n";
+    ss << "  --adaptive               Sample until stable: --target-cv <percent>, --time-budget <ms>\n";
     ss << "  --logger <level>         Logging: -1=silent, 0=normal, 1=info, 2=debug\n\n";
     ss << "EXAMPLES:\n";
     ss << "  kerntopia run conv2d                                    # Use best available backend\n";
@@ -99,6 +99,7 @@ private:
     bool ParseTarget(const std::string& target_str);
     bool ParseMode(const std::string& mode_str);
     bool ParseDevice(const std::string& device_str);
+    bool ParseSampling(const std::string& option, const std::string& value_str);
     void ParseLogLevels(const std::string& value);
     int ParseSingleLogLevel(const std::string& token);
     void SetDefaultProfileTarget();
@@ -3,10 +3,125 @@
 #include <numeric>
 #include <cmath>
 #include <iomanip>
+#include <limits>
+#include <random>
 #include <sstream>
 
 namespace kerntopia {
 
+// Adaptive sampling judges stability on this many most recent samples
+static constexpr size_t kRollingWindow = 10;
+
+static float RollingCoefficientOfVariation(const std::vector<KernelResult>& results, size_t window) {
+    if (results.size() < window) {
+        return std::numeric_limits<float>::infinity();
+    }
+    
+    // Two passes in double: tightly clustered timings cancel out in a single-pass sum of squares
+    const size_t first = results.size() - window;
+    double sum = 0.0;
+    for (size_t i = first; i < results.size(); ++i) {
+        sum += results[i].timing.compute_time_ms;
+    }
+    double mean = sum / window;
+    if (mean <= 0.0) {
+        return std::numeric_limits<float>::infinity();
+    }
+    double squared_deviations = 0.0;
+    for (size_t i = first; i < results.size(); ++i) {
+        double deviation = results[i].timing.compute_time_ms - mean;
+        squared_deviations += deviation * deviation;
+    }
+    return static_cast<float>(std::sqrt(squared_deviations / window) / mean);
+}
+
+// Bootstrap resamples per confidence interval; the fixed seed keeps reports reproducible
+static constexpr size_t kBootstrapResamples = 2000;
+static constexpr uint32_t kBootstrapSeed = 0x6b657274;
+
+// Percentile of ascending samples, interpolating linearly between the closest ranks
+static float Percentile(const std::vector<float>& sorted, float fraction) {
+    float rank = fraction * (sorted.size() - 1);
+    size_t lower = static_cast<size_t>(rank);
+    size_t upper = std::min(lower + 1, sorted.size() - 1);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * (rank - lower);
+}
+
+// Median of unordered values, equal to Percentile(sorted, 0.5) but without a full sort; reorders values
+static float PartialMedian(std::vector<float>& values) {
+    const size_t lower = (values.size() - 1) / 2;
+    std::nth_element(values.begin(), values.begin() + lower, values.end());
+    if (values.size() % 2 == 1) {
+        return values[lower];
+    }
+    float upper = *std::min_element(values.begin() + lower + 1, values.end());
+    return values[lower] + (upper - values[lower]) * 0.5f;
+}
+
+TimingDistribution SummarizeTimings(std::vector<float> samples) {
+    TimingDistribution distribution;
+    if (samples.empty()) {
+        return distribution;
+    }
+    
+    const size_t count = samples.size();
+    std::vector<float> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    
+    distribution.min_ms = sorted.front();
+    distribution.max_ms = sorted.back();
+    distribution.mean_ms = std::accumulate(samples.begin(), samples.end(), 0.0f) / count;
+    float variance = 0.0f;
+    for (float time : samples) {
+        variance += (time - distribution.mean_ms) * (time - distribution.mean_ms);
+    }
+    distribution.std_deviation_ms = std::sqrt(variance / count);
+    
+    distribution.p50_ms = Percentile(sorted, 0.50f);
+    distribution.p90_ms = Percentile(sorted, 0.90f);
+    distribution.p99_ms = Percentile(sorted, 0.99f);
+    distribution.p999_ms = Percentile(sorted, 0.999f);
+    
+    // MAD-based outlier flagging (Iglewicz and Hoaglin); robust where stddev is inflated by the tail itself
+    std::vector<float> deviations(count);
+    for (size_t i = 0; i < count; ++i) {
+        deviations[i] = std::abs(sorted[i] - distribution.p50_ms);
+    }
+    distribution.mad_ms = PartialMedian(deviations);
+    if (distribution.mad_ms > 0.0f) {
+        for (size_t i = 0; i < count; ++i) {
+            if (0.6745f * std::abs(samples[i] - distribution.p50_ms) / distribution.mad_ms > 3.5f) {
+                distribution.outlier_indices.push_back(i);
+            }
+        }
+    }
+    
+    // Percentile bootstrap of mean and median; only the two statistic sets get a full sort
+    std::mt19937 generator(kBootstrapSeed);
+    std::uniform_int_distribution<size_t> pick(0, count - 1);
+    std::vector<float> resample(count);
+    std::vector<float> means(kBootstrapResamples);
+    std::vector<float> medians(kBootstrapResamples);
+    for (size_t r = 0; r < kBootstrapResamples; ++r) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; ++i) {
+            resample[i] = samples[pick(generator)];
+            sum += resample[i];
+        }
+        means[r] = sum / count;
+        medians[r] = PartialMedian(resample);
+    }
+    std::sort(means.begin(), means.end());
+    std::sort(medians.begin(), medians.end());
+    distribution.mean_ci_low_ms = Percentile(means, 0.025f);
+    distribution.mean_ci_high_ms = Percentile(means, 0.975f);
+    distribution.median_ci_low_ms = Percentile(medians, 0.025f);
+    distribution.median_ci_high_ms = Percentile(medians, 0.975f);
+    
+    distribution.samples_ms = std::move(samples);
+    return distribution;
+}
+
 void BaseKernelTest::SetUp() {
     // Initialize test metadata
     test_start_time_ = std::chrono::system_clock::now();
@@ -40,6 +155,9 @@ void BaseKernelTest::SetUp() {
 }
 
 void BaseKernelTest::TearDown() {
+    // Release per-kernel state left behind by a failed run
+    TeardownKernel();
+    
     // Clean up kernel runner
     if (kernel_runner_) {
         kernel_runner_.reset();
@@ -72,21 +190,29 @@ ValidationResults BaseKernelTest::ValidateOutput(const KernelResult& result) {
 Result<KernelResult> BaseKernelTest::RunFunctionalTest() {
     KERNTOPIA_LOG_DEBUG(LogComponent::TEST, "Running functional test with backend: " + config_.GetBackendName());
     
+    auto setup_result = SetupKernel();
+    if (!setup_result.HasValue()) {
+        return KERNTOPIA_RESULT_ERROR(KernelResult, ErrorCategory::TEST, ErrorCode::TEST_SETUP_FAILED,
+                                    "Kernel setup failed: " + setup_result.GetError().message);
+    }
+    
     // Execute kernel
     auto exec_result = ExecuteKernel();
     if (!exec_result.HasValue()) {
+        TeardownKernel();
         return exec_result;
     }
     
     KernelResult& result = *exec_result;
     
-    // Validate output if requested
+    // Validate output if requested, while the output state is still alive
     if (config_.validate_output) {
         result.validation = ValidateOutput(result);
         if (!result.validation.passed) {
             KERNTOPIA_LOG_ERROR(LogComponent::TEST, "Output validation failed");
         }
     }
+    TeardownKernel();
     
     // Save output if requested
     if (config_.save_output && !config_.output_path.empty()) {
@@ -100,19 +226,48 @@ Result<KernelResult> BaseKernelTest::RunFunctionalTest() {
 }
 
 Result<StatisticalSummary> BaseKernelTest::RunPerformanceTest(int iterations) {
+    const size_t warmup_count = static_cast<size_t>(std::max(0, config_.warmup_iterations));
+    const bool adaptive = config_.adaptive_sampling;
+    const size_t min_samples = static_cast<size_t>(std::max(1, iterations));
+    
     KERNTOPIA_LOG_INFO(LogComponent::TEST, "Running performance test with " + 
-                      std::to_string(iterations) + " iterations");
+                      std::to_string(iterations) + " iterations" + (adaptive ? " (adaptive)" : "") + " after " +
+                      std::to_string(warmup_count) + " warm-up");
     
     std::vector<KernelResult> results;
     results.reserve(iterations);
     
+    // Setup and teardown run once so the iterations time the kernel, not runner creation and I/O
+    auto setup_start = std::chrono::steady_clock::now();
+    auto setup_result = SetupKernel();
+    float setup_time_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - setup_start).count();
+    if (!setup_result.HasValue()) {
+        return KERNTOPIA_RESULT_ERROR(StatisticalSummary, ErrorCategory::TEST, ErrorCode::TEST_SETUP_FAILED,
+                                    "Performance test setup failed: " + setup_result.GetError().message);
+    }
+    
+    // Warm-up absorbs pipeline compilation, first-touch page faults and clock ramp
+    for (size_t i = 0; i < warmup_count; ++i) {
+        auto exec_result = ExecuteKernel();
+        if (!exec_result.HasValue()) {
+            TeardownKernel();
+            return KERNTOPIA_RESULT_ERROR(StatisticalSummary, ErrorCategory::TEST,
+                                        ErrorCode::TEST_EXECUTION_FAILED,
+                                        "Performance test failed at warm-up iteration " + std::to_string(i + 1) + 
+                                        ": " + exec_result.GetError().message);
+        }
+    }
+    
     // Run multiple iterations
-    for (int i = 0; i < iterations; ++i) {
+    bool cv_target_met = false;
+    auto sampling_start = std::chrono::steady_clock::now();
+    for (size_t i = 0; ; ++i) {
         KERNTOPIA_LOG_DEBUG(LogComponent::TEST, "Performance iteration " + std::to_string(i + 1) + 
-                           "/" + std::to_string(iterations));
+                           (adaptive ? "" : "/" + std::to_string(iterations)));
         
         auto exec_result = ExecuteKernel();
         if (!exec_result.HasValue()) {
+            TeardownKernel();
             return KERNTOPIA_RESULT_ERROR(StatisticalSummary, ErrorCategory::TEST,
                                         ErrorCode::TEST_EXECUTION_FAILED,
                                         "Performance test failed at iteration " + std::to_string(i + 1) + 
@@ -122,18 +277,57 @@ Result<StatisticalSummary> BaseKernelTest::RunPerformanceTest(int iterations) {
         results.push_back(*exec_result);
         
         // Validate only first and last iterations to save time
-        if (config_.validate_output && (i == 0 || i == iterations - 1)) {
+        if (config_.validate_output && i == 0) {
             results.back().validation = ValidateOutput(results.back());
         }
+        
+        if (!adaptive) {
+            if (results.size() >= min_samples) break;
+            continue;
+        }
+        
+        if (results.size() >= min_samples &&
+            RollingCoefficientOfVariation(results, kRollingWindow) <= config_.target_cv) {
+            cv_target_met = true;
+            break;
+        }
+        // The budget only cuts sampling short past the minimum; iterations is always honoured
+        float elapsed_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - sampling_start).count();
+        if (results.size() >= min_samples && elapsed_ms >= config_.sampling_budget_ms) {
+            KERNTOPIA_LOG_WARNING(LogComponent::TEST, "Sampling budget of " + std::to_string(config_.sampling_budget_ms) +
+                                  "ms spent after " + std::to_string(results.size()) + " samples before the rolling CV reached " +
+                                  std::to_string(config_.target_cv * 100.0f) + "%");
+            break;
+        }
+    }
+    if (config_.validate_output && results.size() > 1) {
+        results.back().validation = ValidateOutput(results.back());
     }
     
+    auto teardown_start = std::chrono::steady_clock::now();
+    TeardownKernel();
+    float teardown_time_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - teardown_start).count();
+    
     // Calculate statistics
     auto stats = CalculateStatistics(results);
+    stats.setup_time_ms = setup_time_ms;
+    stats.teardown_time_ms = teardown_time_ms;
+    stats.warmup_count = warmup_count;
+    stats.cv_target_met = cv_target_met;
     
     KERNTOPIA_LOG_INFO(LogComponent::TEST, "Performance test completed - Mean: " + 
                       std::to_string(stats.mean_time_ms) + "ms, StdDev: " + 
                       std::to_string(stats.std_deviation_ms) + "ms, CV: " + 
-                      std::to_string(stats.coefficient_of_variation * 100.0f) + "%");
+                      std::to_string(stats.coefficient_of_variation * 100.0f) + "%, Samples: " +
+                      std::to_string(stats.sample_count) + " (+" + std::to_string(stats.warmup_count) + " warm-up)");
+    KERNTOPIA_LOG_INFO(LogComponent::TEST, "Compute - p50: " + std::to_string(stats.compute.p50_ms) +
+                      "ms, p90: " + std::to_string(stats.compute.p90_ms) + "ms, p99: " + std::to_string(stats.compute.p99_ms) +
+                      "ms, p99.9: " + std::to_string(stats.compute.p999_ms) + "ms, Median 95% CI: [" +
+                      std::to_string(stats.compute.median_ci_low_ms) + ", " + std::to_string(stats.compute.median_ci_high_ms) +
+                      "]ms, Outliers: " + std::to_string(stats.compute.outlier_indices.size()));
+    KERNTOPIA_LOG_INFO(LogComponent::TEST, "Phases - Setup: " + std::to_string(stats.setup_time_ms) +
+                      "ms, Transfer (mean): " + std::to_string(stats.mean_transfer_time_ms) +
+                      "ms, Teardown: " + std::to_string(stats.teardown_time_ms) + "ms");
     
     return Result<StatisticalSummary>::Success(stats);
 }
@@ -218,12 +412,16 @@ StatisticalSummary BaseKernelTest::CalculateStatistics(const std::vector<KernelR
     
     // Extract timing data
     std::vector<float> compute_times;
+    std::vector<float> memory_setup_times;
+    std::vector<float> memory_teardown_times;
     std::vector<float> total_times;
     std::vector<bool> validation_passed;
     
     for (const auto& result : results) {
         if (result.success) {
             compute_times.push_back(result.timing.compute_time_ms);
+            memory_setup_times.push_back(result.timing.memory_setup_time_ms);
+            memory_teardown_times.push_back(result.timing.memory_teardown_time_ms);
             total_times.push_back(result.timing.total_time_ms);
             validation_passed.push_back(result.validation.passed || result.validation.validation_method.empty());
         }
@@ -233,37 +431,24 @@ StatisticalSummary BaseKernelTest::CalculateStatistics(const std::vector<KernelR
         return summary;
     }
     
-    // Calculate basic statistics
-    auto minmax_compute = std::minmax_element(compute_times.begin(), compute_times.end());
-    summary.min_time_ms = *minmax_compute.first;
-    summary.max_time_ms = *minmax_compute.second;
-    
-    summary.mean_time_ms = std::accumulate(compute_times.begin(), compute_times.end(), 0.0f) / compute_times.size();
+    // Each phase is summarized on its own: tails in transfers or submission do not show in compute
+    summary.compute = SummarizeTimings(std::move(compute_times));
+    summary.memory_setup = SummarizeTimings(std::move(memory_setup_times));
+    summary.memory_teardown = SummarizeTimings(std::move(memory_teardown_times));
+    summary.total = SummarizeTimings(std::move(total_times));
     
-    // Calculate standard deviation
-    float variance = 0.0f;
-    for (float time : compute_times) {
-        float diff = time - summary.mean_time_ms;
-        variance += diff * diff;
-    }
-    variance /= compute_times.size();
-    summary.std_deviation_ms = std::sqrt(variance);
+    summary.min_time_ms = summary.compute.min_ms;
+    summary.max_time_ms = summary.compute.max_ms;
+    summary.mean_time_ms = summary.compute.mean_ms;
+    summary.median_time_ms = summary.compute.p50_ms;
+    summary.std_deviation_ms = summary.compute.std_deviation_ms;
+    summary.mean_transfer_time_ms = summary.memory_setup.mean_ms + summary.memory_teardown.mean_ms;
     
     // Calculate coefficient of variation
     if (summary.mean_time_ms > 0.0f) {
         summary.coefficient_of_variation = summary.std_deviation_ms / summary.mean_time_ms;
     }
     
-    // Calculate median
-    std::vector<float> sorted_times = compute_times;
-    std::sort(sorted_times.begin(), sorted_times.end());
-    size_t mid = sorted_times.size() / 2;
-    if (sorted_times.size() % 2 == 0) {
-        summary.median_time_ms = (sorted_times[mid - 1] + sorted_times[mid]) / 2.0f;
-    } else {
-        summary.median_time_ms = sorted_times[mid];
-    }
-    
     // Calculate validation pass rate
     size_t passed_count = std::count(validation_passed.begin(), validation_passed.end(), true);
     summary.validation_pass_rate = static_cast<float>(passed_count) / validation_passed.size();
@@ -14,6 +14,17 @@
 
 namespace kerntopia {
 
+/**
+ * @brief Describe the distribution of one timing phase
+ * 
+ * Computes moments, percentiles, MAD outliers and bootstrap confidence intervals
+ * (fixed seed, so equal samples always give equal intervals).
+ * 
+ * @param samples Timings in execution order
+ * @return Distribution; all zero for no samples
+ */
+TimingDistribution SummarizeTimings(std::vector<float> samples);
+
 /**
  * @brief Base class for all kernel tests with GTest integration
  * 
@@ -41,6 +52,17 @@ protected:
      */
     virtual Result<void> LoadInputData() { return KERNTOPIA_VOID_SUCCESS(); }
     
+    /**
+     * @brief Prepare everything ExecuteKernel() reuses across iterations
+     * 
+     * Called once before the iterations of RunFunctionalTest() and RunPerformanceTest().
+     * Override to create the runner, load the kernel and inputs and allocate device buffers
+     * here, so each ExecuteKernel() only runs the kernel and reads back its output.
+     * 
+     * @return Success result
+     */
+    virtual Result<void> SetupKernel() { return KERNTOPIA_VOID_SUCCESS(); }
+    
     /**
      * @brief Execute the kernel with current configuration
      * 
@@ -48,6 +70,13 @@ protected:
      */
     virtual Result<KernelResult> ExecuteKernel() = 0;
     
+    /**
+     * @brief Release what SetupKernel() created
+     * 
+     * Called once after the last iteration, and again from TearDown(), so it must be safe to repeat.
+     */
+    virtual void TeardownKernel() {}
+    
     /**
      * @brief Validate kernel output
      * Override in derived classes for specific validation logic
@@ -67,7 +96,11 @@ protected:
     /**
      * @brief Run multiple iterations for performance analysis
      * 
-     * @param iterations Number of iterations
+     * config_.warmup_iterations runs are discarded first. With config_.adaptive_sampling,
+     * @p iterations is the minimum: sampling continues until the coefficient of variation of
+     * the most recent samples reaches config_.target_cv or config_.sampling_budget_ms runs out.
+     * 
+     * @param iterations Number of iterations (minimum in adaptive mode)
      * @return Statistical summary of results
      */
     Result<StatisticalSummary> RunPerformanceTest(int iterations);
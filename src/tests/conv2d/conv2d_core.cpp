@@ -6,6 +6,7 @@
 #include <iostream>
 #include <fstream>
 #include <cmath>
+#include <chrono>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "../../../third-party/stb/stb_image.h"
@@ -29,6 +30,7 @@ Conv2dCore::~Conv2dCore() {
 
 Result<void> Conv2dCore::Setup(const std::string& input_image_path) {
     KERNTOPIA_LOG_INFO(LogComponent::TEST, "Setting up Conv2D...");
+    auto setup_start = std::chrono::steady_clock::now();
     
     // Create backend kernel runner based on configuration
     auto backend_result = BackendFactory::CreateRunner(config_.target_backend, config_.device_id);
@@ -38,8 +40,25 @@ Result<void> Conv2dCore::Setup(const std::string& input_image_path) {
     }
     kernel_runner_ = std::move(backend_result.GetValue());
     
+    // Software Vulkan devices (lavapipe, SwiftShader) are listed under the CPU backend but run SPIR-V
+    if (config_.target_backend == Backend::CPU && kernel_runner_->GetBackendName() == "VULKAN") {
+        KERNTOPIA_LOG_INFO(LogComponent::TEST, "CPU device " + std::to_string(config_.device_id) + " is software Vulkan (" +
+                          kernel_runner_->GetDeviceName() + ", " +
+                          std::to_string(kernel_runner_->GetDeviceInfo().multiprocessor_count) + " threads), using SPIR-V kernels");
+        config_.target_backend = Backend::VULKAN;
+        config_.slang_profile = SlangProfile::GLSL_450;
+        config_.slang_target = SlangTarget::SPIRV;
+    }
+    
     KERNTOPIA_LOG_DEBUG(LogComponent::TEST, "Created " + config_.GetBackendName() + " kernel runner");
     
+    if (config_.collect_counters) {
+        auto counter_result = kernel_runner_->SetCounterCollection(true);
+        if (!counter_result) {
+            KERNTOPIA_LOG_WARNING(LogComponent::TEST, "Device counters unavailable: " + counter_result.GetError().message);
+        }
+    }
+    
     // Load kernel based on configuration
     auto kernel_result = LoadKernel();
     if (!kernel_result) {
@@ -63,7 +82,8 @@ Result<void> Conv2dCore::Setup(const std::string& input_image_path) {
         return result;
     }
     
-    KERNTOPIA_LOG_INFO(LogComponent::TEST, "Conv2D setup complete!");
+    setup_time_ms_ = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - setup_start).count();
+    KERNTOPIA_LOG_INFO(LogComponent::TEST, "Conv2D setup complete! (" + std::to_string(setup_time_ms_) + " ms)");
     return KERNTOPIA_VOID_SUCCESS();
 }
 
@@ -71,30 +91,35 @@ Result<void> Conv2dCore::Execute() {
     KERNTOPIA_LOG_INFO(LogComponent::TEST, "Executing Conv2D kernel...");
     
     // For SLANG-compiled kernels, we need to use backend-specific parameter binding
-    // This works for both CUDA (constant memory) and Vulkan (descriptor sets)
+    // CUDA (constant memory) and CPU (global parameter block) take buffer pointers, Vulkan uses descriptor sets
+    
+    if (!kernel_runner_ || !d_input_image_ || !d_output_image_ || !d_constants_) {
+        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
+                                     "Conv2D not set up; call Setup() before Execute()");
+    }
     
     Result<void> result;
-    if (config_.target_backend == Backend::CUDA) {
-        // CUDA-specific buffer pointer binding
-        auto cuda_input = std::dynamic_pointer_cast<CudaBuffer>(d_input_image_);
-        auto cuda_output = std::dynamic_pointer_cast<CudaBuffer>(d_output_image_);
-        auto cuda_constants = std::dynamic_pointer_cast<CudaBuffer>(d_constants_);
-        
-        if (!cuda_input || !cuda_output || !cuda_constants) {
+    if (config_.target_backend == Backend::CUDA || config_.target_backend == Backend::CPU) {
+        // Buffer pointer binding
+        if (!d_input_image_->GetDeviceAddress() || !d_output_image_->GetDeviceAddress() || !d_constants_->GetDeviceAddress()) {
             return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::BACKEND_OPERATION_FAILED,
-                                         "Failed to cast buffers to CUDA buffers");
+                                         "Buffers have no device addresses");
         }
         
         // Populate the 40-byte parameter buffer based on PTX analysis:
-        // Offset 0: input buffer pointer (8 bytes)
-        // Offset 16: output buffer pointer (8 bytes)  
+        // Offset 0: input buffer pointer (8 bytes), element count (8 bytes)
+        // Offset 16: output buffer pointer (8 bytes), element count (8 bytes)
         // Offset 32: constants buffer pointer (8 bytes)
+        // The host-callable target lays out the block the same way
+        const uint64_t pixel_count = static_cast<uint64_t>(image_width_) * image_height_;
         uint64_t params_buffer[5] = {0}; // 40 bytes total
-        params_buffer[0] = static_cast<uint64_t>(cuda_input->GetDevicePointer());     // Offset 0
-        params_buffer[2] = static_cast<uint64_t>(cuda_output->GetDevicePointer());    // Offset 16 (index 2 = 16/8)
-        params_buffer[4] = static_cast<uint64_t>(cuda_constants->GetDevicePointer()); // Offset 32 (index 4 = 32/8)
+        params_buffer[0] = d_input_image_->GetDeviceAddress();  // Offset 0
+        params_buffer[1] = pixel_count;                         // Offset 8
+        params_buffer[2] = d_output_image_->GetDeviceAddress(); // Offset 16 (index 2 = 16/8)
+        params_buffer[3] = pixel_count;                         // Offset 24
+        params_buffer[4] = d_constants_->GetDeviceAddress();    // Offset 32 (index 4 = 32/8)
         
-        KERNTOPIA_LOG_DEBUG(LogComponent::TEST, "CUDA buffer pointers: input=0x" + 
+        KERNTOPIA_LOG_DEBUG(LogComponent::TEST, "Buffer pointers: input=0x" + 
                            std::to_string(params_buffer[0]) + ", output=0x" + 
                            std::to_string(params_buffer[2]) + ", constants=0x" + 
                            std::to_string(params_buffer[4]));
@@ -143,7 +168,9 @@ Result<void> Conv2dCore::Execute() {
         return result;
     }
     
+    auto readback_start = std::chrono::steady_clock::now();
     result = CopyFromDevice();
+    readback_time_ms_ = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - readback_start).count();
     if (!result) {
         return result;
     }
@@ -189,6 +216,16 @@ Result<void> Conv2dCore::WriteOut(const std::string& output_path) {
     return KERNTOPIA_VOID_SUCCESS();
 }
 
+TimingResults Conv2dCore::GetLastExecutionTime() const {
+    if (!kernel_runner_) {
+        return TimingResults{};
+    }
+    
+    TimingResults timing = kernel_runner_->GetLastExecutionTime();
+    timing.memory_teardown_time_ms = readback_time_ms_;
+    return timing;
+}
+
 void Conv2dCore::TearDown() {
     // Clean up owned kernel runner
     kernel_runner_.reset();
@@ -242,21 +279,38 @@ Result<void> Conv2dCore::AllocateDeviceMemory() {
     KERNTOPIA_LOG_DEBUG(LogComponent::TEST, "Allocating device memory: " + 
                        std::to_string(image_size) + " bytes per image");
     
-    // Create input image buffer
-    auto input_result = kernel_runner_->CreateBuffer(image_size, IBuffer::Type::STORAGE, IBuffer::Usage::DYNAMIC);
-    if (!input_result) {
-        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
-                                     "Failed to allocate input image buffer: " + input_result.GetError().message);
+    // Devices that address host memory (CPU, unified-memory Vulkan) use the host images in place,
+    // which leaves CopyToDevice()/CopyFromDevice() nothing to copy
+    if (kernel_runner_->SupportsFeature("host_memory_import")) {
+        auto wrapped_input = kernel_runner_->WrapHostMemory(h_input_image_.data(), image_size);
+        auto wrapped_output = kernel_runner_->WrapHostMemory(h_output_image_.data(), image_size);
+        if (wrapped_input && wrapped_output) {
+            d_input_image_ = wrapped_input.GetValue();
+            d_output_image_ = wrapped_output.GetValue();
+            KERNTOPIA_LOG_DEBUG(LogComponent::TEST, "Host images bound without copies");
+        } else {
+            KERNTOPIA_LOG_WARNING(LogComponent::TEST, "Host memory import failed, falling back to copies: " +
+                                  (wrapped_input ? wrapped_output.GetError().message : wrapped_input.GetError().message));
+        }
     }
-    d_input_image_ = input_result.GetValue();
     
-    // Create output image buffer
-    auto output_result = kernel_runner_->CreateBuffer(image_size, IBuffer::Type::STORAGE, IBuffer::Usage::DYNAMIC);
-    if (!output_result) {
-        return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
-                                     "Failed to allocate output image buffer: " + output_result.GetError().message);
+    if (!d_input_image_ || !d_output_image_) {
+        // Create input image buffer
+        auto input_result = kernel_runner_->CreateBuffer(image_size, IBuffer::Type::STORAGE, IBuffer::Usage::DYNAMIC);
+        if (!input_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                         "Failed to allocate input image buffer: " + input_result.GetError().message);
+        }
+        d_input_image_ = input_result.GetValue();
+        
+        // Create output image buffer
+        auto output_result = kernel_runner_->CreateBuffer(image_size, IBuffer::Type::STORAGE, IBuffer::Usage::DYNAMIC);
+        if (!output_result) {
+            return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::MEMORY_ALLOCATION_FAILED,
+                                         "Failed to allocate output image buffer: " + output_result.GetError().message);
+        }
+        d_output_image_ = output_result.GetValue();
     }
-    d_output_image_ = output_result.GetValue();
     
     // Create constants buffer
     auto constants_result = kernel_runner_->CreateBuffer(sizeof(Constants), IBuffer::Type::UNIFORM, IBuffer::Usage::STATIC);
@@ -374,7 +428,7 @@ Result<void> Conv2dCore::LoadKernel() {
     }
     
     // Load kernel into the runner - use backend-appropriate entry point
-    std::string entry_point = (config_.target_backend == Backend::CUDA) ? "computeMain" : "main";
+    std::string entry_point = (config_.target_backend == Backend::CUDA || config_.target_backend == Backend::CPU) ? "computeMain" : "main";
     auto load_result = kernel_runner_->LoadKernel(bytecode, entry_point);
     if (!load_result) {
         return KERNTOPIA_RESULT_ERROR(void, ErrorCategory::BACKEND, ErrorCode::KERNEL_LOAD_FAILED,
@@ -392,6 +446,18 @@ std::string Conv2dCore::GetKernelPath() const {
     // Dynamically determine kernels directory based on executable location
     std::string kernels_dir = PathUtils::GetKernelsDirectory();
     
+    // CPU kernels are also built per SIMD ISA (conv2d-host-avx2.so); use the widest this host runs
+    if (config_.target_backend == Backend::CPU && kernel_runner_) {
+        size_t extension_pos = kernel_filename.rfind('.');
+        for (const std::string& isa : kernel_runner_->GetDeviceInfo().supported_extensions) {
+            std::string variant_path = kernels_dir + kernel_filename.substr(0, extension_pos) + "-" + isa +
+                                       kernel_filename.substr(extension_pos);
+            if (std::ifstream(variant_path).good()) {
+                return variant_path;
+            }
+        }
+    }
+    
     return kernels_dir + kernel_filename;
 }
 
@@ -15,22 +15,18 @@ public:
     Conv2dCore(const kerntopia::TestConfiguration& config);
     ~Conv2dCore();
 
-    // Main pipeline functions - Conv2DCore handles kernel loading based on config
+    // Main pipeline functions - Conv2DCore handles kernel loading based on config.
+    // Setup() once, then Execute() as often as needed; each run reuses the runner, kernel and buffers.
     kerntopia::Result<void> Setup(const std::string& input_image_path);
     kerntopia::Result<void> Execute();
     kerntopia::Result<void> WriteOut(const std::string& output_path);
     void TearDown();
+    bool IsSetUp() const { return kernel_runner_ != nullptr; }
 
     // Expose backend information for testing
     std::string GetDeviceName() const { return kernel_runner_ ? kernel_runner_->GetDeviceName() : "Unknown"; }
-    kerntopia::TimingResults GetLastExecutionTime() const { 
-        if (kernel_runner_) {
-            return kernel_runner_->GetLastExecutionTime();
-        } else {
-            kerntopia::TimingResults empty_timing{};
-            return empty_timing;
-        }
-    }
+    kerntopia::TimingResults GetLastExecutionTime() const;   ///< Runner timing of the last Execute(), readback included
+    float GetSetupTimeMs() const { return setup_time_ms_; }  ///< Host time spent in the last Setup()
 
 private:
     // Configuration and backend abstraction
@@ -46,9 +42,10 @@ private:
     std::shared_ptr<kerntopia::IBuffer> d_output_image_;
     std::shared_ptr<kerntopia::IBuffer> d_constants_;
     
-    // Image data - using float4 (RGBA) to match SLANG float3 alignment
-    std::vector<float> h_input_image_;   // Host input image (RGBA float)
-    std::vector<float> h_output_image_;  // Host output image (RGBA float)
+    // Image data - using float4 (RGBA) to match SLANG float3 alignment; page aligned so the
+    // device buffers can wrap them where the backend addresses host memory
+    std::vector<float, kerntopia::HostImportAllocator<float>> h_input_image_;   // Host input image (RGBA float)
+    std::vector<float, kerntopia::HostImportAllocator<float>> h_output_image_;  // Host output image (RGBA float)
     
     // Image dimensions
     uint32_t image_width_;
@@ -63,6 +60,10 @@ private:
     
     Constants constants_;
     
+    // Host-measured phase times
+    float setup_time_ms_ = 0.0f;
+    float readback_time_ms_ = 0.0f;
+    
     // Helper functions
     kerntopia::Result<void> LoadInputImage(const std::string& input_path);
     kerntopia::Result<void> AllocateDeviceMemory();
@@ -120,10 +120,13 @@ int main(int argc, char* argv[]) {
             config.slang_target = kerntopia::SlangTarget::PTX;
             break;
         case kerntopia::Backend::VULKAN:
-        case kerntopia::Backend::CPU:
             config.slang_profile = kerntopia::SlangProfile::GLSL_450;
             config.slang_target = kerntopia::SlangTarget::SPIRV;
             break;
+        case kerntopia::Backend::CPU:
+            config.slang_profile = kerntopia::SlangProfile::HOST;
+            config.slang_target = kerntopia::SlangTarget::SHADER_SHAREDLIB;
+            break;
         default:
             config.slang_profile = kerntopia::SlangProfile::CUDA_SM_7_0;
             config.slang_target = kerntopia::SlangTarget::PTX;
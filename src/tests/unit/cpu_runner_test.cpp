@@ -0,0 +1,158 @@
+#include "core/backend/cpu_runner.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace kerntopia {
+
+namespace {
+
+// Must match the block read by cpu_test_kernel.cpp
+struct GroupCounterParams {
+    std::atomic<uint32_t>* counters;
+    uint32_t groups[3];
+};
+
+// Odd and lopsided grids, so Morton order cannot rely on powers of two or square shapes
+const uint32_t kOddGrids[][3] = {
+    {1, 1, 1}, {7, 1, 1}, {1, 9, 1}, {3, 5, 1}, {5, 3, 1},
+    {13, 7, 3}, {1, 9, 2}, {17, 31, 1}, {33, 2, 5}, {129, 3, 1},
+};
+
+std::vector<uint8_t> ReadTestKernel() {
+    std::ifstream file(KERNTOPIA_CPU_TEST_KERNEL, std::ios::binary);
+    return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+TEST(CpuTileOrderTest, MortonOrderIsPermutationOfAllGroups) {
+    for (const auto& groups : kOddGrids) {
+        std::vector<uint32_t> order = BuildMortonTileOrder(groups);
+        
+        std::vector<uint32_t> expected(static_cast<size_t>(groups[0]) * groups[1] * groups[2]);
+        std::iota(expected.begin(), expected.end(), 0u);
+        std::sort(order.begin(), order.end());
+        EXPECT_EQ(order, expected) << "grid " << groups[0] << "x" << groups[1] << "x" << groups[2];
+    }
+}
+
+TEST(CpuTileOrderTest, MortonOrderWalksQuadsAndKeepsRows) {
+    // The first four tiles of a 2D grid form its top-left 2x2 quad
+    const uint32_t square[3] = {4, 4, 1};
+    std::vector<uint32_t> order = BuildMortonTileOrder(square);
+    EXPECT_EQ(std::vector<uint32_t>(order.begin(), order.begin() + 4), (std::vector<uint32_t>{0, 1, 4, 5}));
+    
+    // Slices stay contiguous: every group of z = 0 comes before any group of z = 1
+    const uint32_t layered[3] = {3, 3, 2};
+    order = BuildMortonTileOrder(layered);
+    EXPECT_TRUE(std::all_of(order.begin(), order.begin() + 9, [](uint32_t index) { return index < 9; }));
+    
+    // A single row keeps its linear order
+    const uint32_t row[3] = {11, 1, 1};
+    order = BuildMortonTileOrder(row);
+    std::vector<uint32_t> linear(11);
+    std::iota(linear.begin(), linear.end(), 0u);
+    EXPECT_EQ(order, linear);
+}
+
+TEST(CpuTileOrderTest, MortonOrderKeepsWideGridsUnambiguous) {
+    // Past 65535 groups along x the codes need more than 16 bits per axis; x = 65536 must follow
+    // every tile of the 65536x2 block before it instead of colliding with x = 0
+    const uint32_t wide[3] = {70000, 2, 1};
+    std::vector<uint32_t> order = BuildMortonTileOrder(wide);
+    ASSERT_EQ(order.size(), 140000u);
+    EXPECT_EQ(order[2 * 65536], 65536u);
+    EXPECT_TRUE(std::all_of(order.begin(), order.begin() + 2 * 65536,
+                            [](uint32_t index) { return index % 70000 < 65536; }));
+}
+
+TEST(CpuWorkerThreadCountTest, AcceptsPlainPositiveCounts) {
+    EXPECT_EQ(ParseWorkerThreadCount("1", 8), 1u);
+    EXPECT_EQ(ParseWorkerThreadCount("12", 8), 12u);
+    EXPECT_EQ(ParseWorkerThreadCount(nullptr, 8), 8u);
+    EXPECT_EQ(ParseWorkerThreadCount("", 8), 8u);
+}
+
+TEST(CpuWorkerThreadCountTest, FallsBackOnInvalidValues) {
+    // A leading '-' must not wrap to a huge unsigned count
+    for (const char* value : {"-1", "-0", "+4", " 4", "0", "4x", "four", "1.5"}) {
+        EXPECT_EQ(ParseWorkerThreadCount(value, 8), 8u) << "value '" << value << "'";
+    }
+}
+
+TEST(CpuWorkerThreadCountTest, ClampsOversizedValues) {
+    EXPECT_EQ(ParseWorkerThreadCount("1024", 8), kMaxCpuWorkerThreads);
+    EXPECT_EQ(ParseWorkerThreadCount("1025", 8), kMaxCpuWorkerThreads);
+    EXPECT_EQ(ParseWorkerThreadCount("4294967295", 8), kMaxCpuWorkerThreads);
+    EXPECT_EQ(ParseWorkerThreadCount("99999999999999999999999", 8), kMaxCpuWorkerThreads);
+}
+
+class CpuRunnerSchedulingTest : public ::testing::TestWithParam<uint32_t> {
+protected:
+    void SetUp() override {
+        DeviceInfo device_info;
+        device_info.name = "CPU (test)";
+        device_info.multiprocessor_count = GetParam();
+        runner_ = std::make_unique<CpuKernelRunner>(0, device_info);
+        
+        auto load_result = runner_->LoadKernel(ReadTestKernel(), "countGroups");
+        ASSERT_TRUE(load_result.HasValue()) << load_result.GetError().message;
+    }
+    
+    // Dispatch the grid with fresh counters and return how often each group ran
+    std::vector<uint32_t> CountGroups(const uint32_t groups[3], uint32_t replays = 0) {
+        const size_t group_count = static_cast<size_t>(groups[0]) * groups[1] * groups[2];
+        std::unique_ptr<std::atomic<uint32_t>[]> counters(new std::atomic<uint32_t>[group_count]);
+        for (size_t i = 0; i < group_count; ++i) {
+            counters[i].store(0);
+        }
+        GroupCounterParams params = {counters.get(), {groups[0], groups[1], groups[2]}};
+        EXPECT_TRUE(runner_->SetSlangGlobalParameters(&params, sizeof(params)).HasValue());
+        
+        if (replays == 0) {
+            EXPECT_TRUE(runner_->Dispatch(groups[0], groups[1], groups[2]).HasValue());
+        } else {
+            EXPECT_TRUE(runner_->RecordDispatch(groups[0], groups[1], groups[2]).HasValue());
+            EXPECT_TRUE(runner_->ReplayRecorded(replays).HasValue());
+        }
+        EXPECT_TRUE(runner_->WaitForCompletion().HasValue());
+        
+        std::vector<uint32_t> runs(group_count);
+        for (size_t i = 0; i < group_count; ++i) {
+            runs[i] = counters[i].load();
+        }
+        return runs;
+    }
+    
+    std::unique_ptr<CpuKernelRunner> runner_;
+};
+
+TEST_P(CpuRunnerSchedulingTest, RunsEveryGroupExactlyOnce) {
+    // Twice per grid: the second dispatch reuses the cached tile order
+    for (int pass = 0; pass < 2; ++pass) {
+        for (const auto& groups : kOddGrids) {
+            std::vector<uint32_t> runs = CountGroups(groups);
+            auto wrong = std::find_if(runs.begin(), runs.end(), [](uint32_t count) { return count != 1; });
+            EXPECT_EQ(wrong, runs.end()) << "grid " << groups[0] << "x" << groups[1] << "x" << groups[2]
+                                         << ": group " << (wrong - runs.begin()) << " ran "
+                                         << (wrong != runs.end() ? *wrong : 1) << " times";
+        }
+    }
+}
+
+TEST_P(CpuRunnerSchedulingTest, ReplaysRunEveryGroupOncePerIteration) {
+    const uint32_t groups[3] = {13, 7, 3};
+    std::vector<uint32_t> runs = CountGroups(groups, 4);
+    EXPECT_TRUE(std::all_of(runs.begin(), runs.end(), [](uint32_t count) { return count == 4; }));
+}
+
+// Thread counts below, at and above the group counts of the smaller grids, including odd ones
+INSTANTIATE_TEST_SUITE_P(ThreadCounts, CpuRunnerSchedulingTest, ::testing::Values(1u, 2u, 3u, 7u, 16u));
+
+} // namespace kerntopia
@@ -0,0 +1,35 @@
+// Host kernel for the CPU runner tests: counts how often each group of the grid runs.
+// Built as a loadable module with the same entry point signature Slang emits for the
+// shader-sharedlib target.
+#include "core/backend/cpu_runner.hpp"
+#include <atomic>
+#include <cstdint>
+
+#ifdef _WIN32
+#define KERNTOPIA_TEST_KERNEL_EXPORT extern "C" __declspec(dllexport)
+#else
+#define KERNTOPIA_TEST_KERNEL_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace {
+
+// Global parameter block shared with cpu_runner_test.cpp
+struct GroupCounterParams {
+    std::atomic<uint32_t>* counters;
+    uint32_t groups[3];
+};
+
+} // namespace
+
+KERNTOPIA_TEST_KERNEL_EXPORT void countGroups(kerntopia::CpuVaryingInput* varying_input, void* /*entry_point_params*/,
+                                              void* global_params) {
+    const GroupCounterParams* params = static_cast<const GroupCounterParams*>(global_params);
+    for (uint32_t z = varying_input->start_group_id[2]; z < varying_input->end_group_id[2]; ++z) {
+        for (uint32_t y = varying_input->start_group_id[1]; y < varying_input->end_group_id[1]; ++y) {
+            for (uint32_t x = varying_input->start_group_id[0]; x < varying_input->end_group_id[0]; ++x) {
+                uint32_t index = (z * params->groups[1] + y) * params->groups[0] + x;
+                params->counters[index].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+}
@@ -0,0 +1,365 @@
+#include "core/backend/spirv_reflection.hpp"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace kerntopia {
+
+namespace {
+
+// SPIR-V opcodes and enumerants used to assemble test modules (SPIR-V specification, section 3)
+constexpr uint32_t kMagic = 0x07230203;
+constexpr uint32_t OpName = 5;
+constexpr uint32_t OpEntryPoint = 15;
+constexpr uint32_t OpExecutionMode = 16;
+constexpr uint32_t OpCapability = 17;
+constexpr uint32_t OpTypeInt = 21;
+constexpr uint32_t OpTypeFloat = 22;
+constexpr uint32_t OpTypeVector = 23;
+constexpr uint32_t OpTypeImage = 25;
+constexpr uint32_t OpTypeSampler = 26;
+constexpr uint32_t OpTypeArray = 28;
+constexpr uint32_t OpTypeRuntimeArray = 29;
+constexpr uint32_t OpTypeStruct = 30;
+constexpr uint32_t OpTypePointer = 32;
+constexpr uint32_t OpConstant = 43;
+constexpr uint32_t OpSpecConstant = 50;
+constexpr uint32_t OpSpecConstantComposite = 51;
+constexpr uint32_t OpVariable = 59;
+constexpr uint32_t OpDecorate = 71;
+constexpr uint32_t OpMemberDecorate = 72;
+constexpr uint32_t OpExecutionModeId = 331;
+
+constexpr uint32_t ExecutionModelVertex = 0;
+constexpr uint32_t ExecutionModelGLCompute = 5;
+constexpr uint32_t LocalSize = 17;
+constexpr uint32_t LocalSizeId = 38;
+
+constexpr uint32_t SpecId = 1;
+constexpr uint32_t Block = 2;
+constexpr uint32_t BufferBlock = 3;
+constexpr uint32_t BuiltIn = 11;
+constexpr uint32_t Binding = 33;
+constexpr uint32_t DescriptorSet = 34;
+constexpr uint32_t Offset = 35;
+constexpr uint32_t WorkgroupSize = 25;
+
+constexpr uint32_t UniformConstant = 0;
+constexpr uint32_t Uniform = 2;
+constexpr uint32_t PushConstant = 9;
+constexpr uint32_t StorageBuffer = 12;
+constexpr uint32_t PhysicalStorageBuffer = 5349;
+constexpr uint32_t PhysicalStorageBufferAddresses = 5347;
+
+// Entry point id shared by the test modules
+constexpr uint32_t kMain = 1;
+
+/**
+ * @brief Minimal SPIR-V assembler: header plus instructions appended word by word
+ */
+class SpirvModule {
+public:
+    SpirvModule() : words_{kMagic, 0x00010300, 0, 100, 0} {}
+    
+    SpirvModule& Op(uint32_t opcode, std::vector<uint32_t> operands) {
+        words_.push_back(static_cast<uint32_t>(operands.size() + 1) << 16 | opcode);
+        words_.insert(words_.end(), operands.begin(), operands.end());
+        return *this;
+    }
+    
+    SpirvModule& EntryPoint(uint32_t model, uint32_t id, const std::string& name) {
+        std::vector<uint32_t> operands = {model, id};
+        AppendString(operands, name);
+        return Op(OpEntryPoint, operands);
+    }
+    
+    SpirvModule& Name(uint32_t id, const std::string& name) {
+        std::vector<uint32_t> operands = {id};
+        AppendString(operands, name);
+        return Op(OpName, operands);
+    }
+    
+    std::vector<uint32_t>& Words() { return words_; }
+    
+    std::vector<uint8_t> Bytes() const {
+        std::vector<uint8_t> bytes(words_.size() * 4);
+        std::memcpy(bytes.data(), words_.data(), bytes.size());
+        return bytes;
+    }
+    
+private:
+    // Literal strings are nul terminated and padded to a whole word
+    static void AppendString(std::vector<uint32_t>& operands, const std::string& text) {
+        std::vector<uint32_t> packed(text.size() / 4 + 1, 0);
+        std::memcpy(packed.data(), text.data(), text.size());
+        operands.insert(operands.end(), packed.begin(), packed.end());
+    }
+    
+    std::vector<uint32_t> words_;
+};
+
+// GLCompute entry point "main" with a literal 8x4x2 workgroup
+SpirvModule LiteralLocalSizeModule() {
+    SpirvModule module;
+    module.EntryPoint(ExecutionModelGLCompute, kMain, "main")
+          .Op(OpExecutionMode, {kMain, LocalSize, 8, 4, 2});
+    return module;
+}
+
+} // namespace
+
+TEST(SpirvReflectionTest, RejectsTruncatedModule) {
+    std::vector<uint8_t> bytes = LiteralLocalSizeModule().Bytes();
+    
+    // Shorter than the header
+    auto header_only = ReflectSpirv(std::vector<uint8_t>(bytes.begin(), bytes.begin() + 12), "main");
+    EXPECT_FALSE(header_only.HasValue());
+    
+    // Not a whole number of words
+    auto unaligned = ReflectSpirv(std::vector<uint8_t>(bytes.begin(), bytes.end() - 2), "main");
+    EXPECT_FALSE(unaligned.HasValue());
+    
+    // The last instruction claims more words than remain
+    auto cut = ReflectSpirv(std::vector<uint8_t>(bytes.begin(), bytes.end() - 4), "main");
+    ASSERT_FALSE(cut.HasValue());
+    EXPECT_NE(cut.GetError().message.find("Malformed"), std::string::npos);
+    
+    // A zero word count would never advance
+    SpirvModule zero = LiteralLocalSizeModule();
+    zero.Words().push_back(0);
+    EXPECT_FALSE(ReflectSpirv(zero.Bytes(), "main").HasValue());
+}
+
+TEST(SpirvReflectionTest, RejectsBadMagic) {
+    SpirvModule module = LiteralLocalSizeModule();
+    module.Words()[0] = 0x03022307;     // Byte-swapped magic
+    
+    auto result = ReflectSpirv(module.Bytes(), "main");
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_NE(result.GetError().message.find("magic"), std::string::npos);
+    
+    const uint32_t size[3] = {16, 1, 1};
+    EXPECT_FALSE(PatchSpirvLocalSize(module.Bytes(), "main", size).HasValue());
+}
+
+TEST(SpirvReflectionTest, RejectsMissingEntryPoint) {
+    SpirvModule module = LiteralLocalSizeModule();
+    module.EntryPoint(ExecutionModelVertex, 2, "vertexMain");
+    
+    EXPECT_FALSE(ReflectSpirv(module.Bytes(), "computeMain").HasValue());
+    // Only GLCompute entry points count, even when the name matches
+    auto vertex = ReflectSpirv(module.Bytes(), "vertexMain");
+    ASSERT_FALSE(vertex.HasValue());
+    EXPECT_NE(vertex.GetError().message.find("vertexMain"), std::string::npos);
+    
+    const uint32_t size[3] = {16, 1, 1};
+    EXPECT_FALSE(PatchSpirvLocalSize(module.Bytes(), "computeMain", size).HasValue());
+}
+
+TEST(SpirvReflectionTest, ReadsLiteralLocalSize) {
+    auto result = ReflectSpirv(LiteralLocalSizeModule().Bytes(), "main");
+    ASSERT_TRUE(result.HasValue()) << result.GetError().message;
+    
+    const SpirvReflection& reflection = result.GetValue();
+    EXPECT_EQ(reflection.entry_point, "main");
+    EXPECT_TRUE(reflection.has_local_size);
+    EXPECT_EQ(reflection.local_size[0], 8u);
+    EXPECT_EQ(reflection.local_size[1], 4u);
+    EXPECT_EQ(reflection.local_size[2], 2u);
+    for (int32_t spec_id : reflection.local_size_spec_ids) {
+        EXPECT_EQ(spec_id, -1);
+    }
+    EXPECT_TRUE(reflection.bindings.empty());
+    EXPECT_EQ(reflection.push_constant_size, 0u);
+}
+
+TEST(SpirvReflectionTest, ReadsLocalSizeIdConstants) {
+    SpirvModule module;
+    module.EntryPoint(ExecutionModelGLCompute, kMain, "main")
+          .Op(OpExecutionModeId, {kMain, LocalSizeId, 40, 41, 42})
+          .Name(41, "blockY")
+          .Op(OpDecorate, {41, SpecId, 7})
+          .Op(OpTypeInt, {10, 32, 0})
+          .Op(OpConstant, {10, 40, 8})
+          .Op(OpSpecConstant, {10, 41, 4})
+          .Op(OpConstant, {10, 42, 1});
+    
+    auto result = ReflectSpirv(module.Bytes(), "main");
+    ASSERT_TRUE(result.HasValue()) << result.GetError().message;
+    
+    const SpirvReflection& reflection = result.GetValue();
+    EXPECT_TRUE(reflection.has_local_size);
+    EXPECT_EQ(reflection.local_size[0], 8u);
+    EXPECT_EQ(reflection.local_size[1], 4u);
+    EXPECT_EQ(reflection.local_size[2], 1u);
+    EXPECT_EQ(reflection.local_size_spec_ids[0], -1);
+    EXPECT_EQ(reflection.local_size_spec_ids[1], 7);
+    EXPECT_EQ(reflection.local_size_spec_ids[2], -1);
+    
+    ASSERT_EQ(reflection.spec_constants.size(), 1u);
+    const SpirvSpecConstant* spec = reflection.FindSpecConstant(7);
+    ASSERT_NE(spec, nullptr);
+    EXPECT_EQ(spec->default_value, 4u);
+    EXPECT_EQ(spec->size, 4u);
+    EXPECT_EQ(spec->name, "blockY");
+    
+    // Sizes that are not literals cannot be patched
+    const uint32_t size[3] = {16, 1, 1};
+    EXPECT_FALSE(PatchSpirvLocalSize(module.Bytes(), "main", size).HasValue());
+}
+
+TEST(SpirvReflectionTest, WorkgroupSizeBuiltinOverridesLocalSize) {
+    SpirvModule module = LiteralLocalSizeModule();
+    module.Op(OpDecorate, {44, SpecId, 0})
+          .Op(OpDecorate, {45, SpecId, 1})
+          .Op(OpDecorate, {46, BuiltIn, WorkgroupSize})
+          .Op(OpTypeInt, {10, 32, 0})
+          .Op(OpTypeVector, {43, 10, 3})
+          .Op(OpSpecConstant, {10, 44, 16})
+          .Op(OpSpecConstant, {10, 45, 2})
+          .Op(OpConstant, {10, 42, 1})
+          .Op(OpSpecConstantComposite, {43, 46, 44, 45, 42});
+    
+    auto result = ReflectSpirv(module.Bytes(), "main");
+    ASSERT_TRUE(result.HasValue()) << result.GetError().message;
+    
+    const SpirvReflection& reflection = result.GetValue();
+    EXPECT_EQ(reflection.local_size[0], 16u);
+    EXPECT_EQ(reflection.local_size[1], 2u);
+    EXPECT_EQ(reflection.local_size[2], 1u);
+    EXPECT_EQ(reflection.local_size_spec_ids[0], 0);
+    EXPECT_EQ(reflection.local_size_spec_ids[1], 1);
+    EXPECT_EQ(reflection.local_size_spec_ids[2], -1);
+    EXPECT_EQ(reflection.spec_constants.size(), 2u);
+    
+    // Patching LocalSize would be shadowed by the builtin
+    const uint32_t size[3] = {32, 1, 1};
+    auto patched = PatchSpirvLocalSize(module.Bytes(), "main", size);
+    ASSERT_FALSE(patched.HasValue());
+    EXPECT_NE(patched.GetError().message.find("WorkgroupSize"), std::string::npos);
+}
+
+TEST(SpirvReflectionTest, PatchesLiteralLocalSizeOfOneEntryPoint) {
+    SpirvModule module = LiteralLocalSizeModule();
+    module.EntryPoint(ExecutionModelGLCompute, 2, "other")
+          .Op(OpExecutionMode, {2, LocalSize, 64, 1, 1});
+    std::vector<uint8_t> original = module.Bytes();
+    
+    const uint32_t size[3] = {32, 2, 1};
+    auto patched = PatchSpirvLocalSize(original, "main", size);
+    ASSERT_TRUE(patched.HasValue()) << patched.GetError().message;
+    EXPECT_EQ(patched.GetValue().size(), original.size());
+    
+    auto main_reflection = ReflectSpirv(patched.GetValue(), "main");
+    ASSERT_TRUE(main_reflection.HasValue());
+    EXPECT_EQ(main_reflection.GetValue().local_size[0], 32u);
+    EXPECT_EQ(main_reflection.GetValue().local_size[1], 2u);
+    EXPECT_EQ(main_reflection.GetValue().local_size[2], 1u);
+    
+    auto other_reflection = ReflectSpirv(patched.GetValue(), "other");
+    ASSERT_TRUE(other_reflection.HasValue());
+    EXPECT_EQ(other_reflection.GetValue().local_size[0], 64u);
+    
+    // The input module is left untouched
+    EXPECT_EQ(original, module.Bytes());
+    EXPECT_EQ(ReflectSpirv(original, "main").GetValue().local_size[0], 8u);
+}
+
+TEST(SpirvReflectionTest, ExtractsBindingsAndPushConstants) {
+    SpirvModule module;
+    module.Op(OpCapability, {PhysicalStorageBufferAddresses})
+          .EntryPoint(ExecutionModelGLCompute, kMain, "main")
+          .Op(OpExecutionMode, {kMain, LocalSize, 16, 16, 1})
+          .Name(22, "params")
+          .Name(26, "output")
+          .Name(29, "legacy")
+          .Name(34, "images")
+          // Push constants: uint at 0, float4 at 16, buffer address at 32
+          .Op(OpMemberDecorate, {13, 0, Offset, 0})
+          .Op(OpMemberDecorate, {13, 1, Offset, 16})
+          .Op(OpMemberDecorate, {13, 2, Offset, 32})
+          .Op(OpDecorate, {13, Block})
+          .Op(OpDecorate, {20, Block})
+          .Op(OpDecorate, {22, DescriptorSet, 0})
+          .Op(OpDecorate, {22, Binding, 0})
+          .Op(OpDecorate, {24, Block})
+          .Op(OpDecorate, {26, DescriptorSet, 0})
+          .Op(OpDecorate, {26, Binding, 1})
+          .Op(OpDecorate, {27, BufferBlock})
+          .Op(OpDecorate, {29, DescriptorSet, 0})
+          .Op(OpDecorate, {29, Binding, 3})
+          .Op(OpDecorate, {34, DescriptorSet, 0})
+          .Op(OpDecorate, {34, Binding, 2})
+          .Op(OpDecorate, {37, DescriptorSet, 1})
+          .Op(OpDecorate, {37, Binding, 0})
+          .Op(OpTypeInt, {10, 32, 0})
+          .Op(OpTypeFloat, {11, 32})
+          .Op(OpTypeVector, {12, 11, 4})
+          .Op(OpTypePointer, {14, PhysicalStorageBuffer, 10})
+          .Op(OpTypeStruct, {13, 10, 12, 14})
+          .Op(OpTypePointer, {15, PushConstant, 13})
+          .Op(OpVariable, {15, 16, PushConstant})
+          // Uniform block
+          .Op(OpTypeStruct, {20, 12})
+          .Op(OpTypePointer, {21, Uniform, 20})
+          .Op(OpVariable, {21, 22, Uniform})
+          // Storage buffer, current and pre-1.3 (Uniform + BufferBlock) forms
+          .Op(OpTypeRuntimeArray, {23, 10})
+          .Op(OpTypeStruct, {24, 23})
+          .Op(OpTypePointer, {25, StorageBuffer, 24})
+          .Op(OpVariable, {25, 26, StorageBuffer})
+          .Op(OpTypeStruct, {27, 23})
+          .Op(OpTypePointer, {28, Uniform, 27})
+          .Op(OpVariable, {28, 29, Uniform})
+          // Array of four 2D storage images
+          .Op(OpTypeImage, {30, 11, 1, 0, 0, 0, 2, 1})
+          .Op(OpConstant, {10, 31, 4})
+          .Op(OpTypeArray, {32, 30, 31})
+          .Op(OpTypePointer, {33, UniformConstant, 32})
+          .Op(OpVariable, {33, 34, UniformConstant})
+          // Sampler in set 1, and one without a binding that must be skipped
+          .Op(OpTypeSampler, {35})
+          .Op(OpTypePointer, {36, UniformConstant, 35})
+          .Op(OpVariable, {36, 37, UniformConstant})
+          .Op(OpVariable, {36, 38, UniformConstant});
+    
+    auto result = ReflectSpirv(module.Bytes(), "main");
+    ASSERT_TRUE(result.HasValue()) << result.GetError().message;
+    const SpirvReflection& reflection = result.GetValue();
+    
+    EXPECT_TRUE(reflection.uses_device_addresses);
+    EXPECT_EQ(reflection.push_constant_size, 40u);
+    
+    // Sorted by (set, binding) regardless of declaration order
+    ASSERT_EQ(reflection.bindings.size(), 5u);
+    const struct {
+        uint32_t set;
+        uint32_t binding;
+        SpirvDescriptorType type;
+        uint32_t count;
+        const char* name;
+    } expected[] = {
+        {0, 0, SpirvDescriptorType::UNIFORM_BUFFER, 1, "params"},
+        {0, 1, SpirvDescriptorType::STORAGE_BUFFER, 1, "output"},
+        {0, 2, SpirvDescriptorType::STORAGE_IMAGE, 4, "images"},
+        {0, 3, SpirvDescriptorType::STORAGE_BUFFER, 1, "legacy"},
+        {1, 0, SpirvDescriptorType::SAMPLER, 1, ""},
+    };
+    for (size_t i = 0; i < reflection.bindings.size(); ++i) {
+        const SpirvDescriptorBinding& binding = reflection.bindings[i];
+        EXPECT_EQ(binding.set, expected[i].set) << "binding " << i;
+        EXPECT_EQ(binding.binding, expected[i].binding) << "binding " << i;
+        EXPECT_EQ(binding.type, expected[i].type) << "binding " << i;
+        EXPECT_EQ(binding.count, expected[i].count) << "binding " << i;
+        EXPECT_EQ(binding.name, expected[i].name) << "binding " << i;
+    }
+    
+    ASSERT_NE(reflection.FindBinding(1), nullptr);
+    EXPECT_EQ(reflection.FindBinding(1)->name, "output");
+    EXPECT_NE(reflection.FindBinding(0, 1), nullptr);
+    EXPECT_EQ(reflection.FindBinding(4), nullptr);
+    EXPECT_EQ(reflection.GetLayoutSignature(), "0.0:6x1;0.1:7x1;0.2:3x4;0.3:7x1;1.0:0x1;pc40");
+}
+
+} // namespace kerntopia
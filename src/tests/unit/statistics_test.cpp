@@ -0,0 +1,118 @@
+#include "tests/common/base_test.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace kerntopia {
+
+TEST(StatisticsTest, SummarizesKnownSamples) {
+    TimingDistribution distribution = SummarizeTimings({4.0f, 2.0f, 5.0f, 1.0f, 3.0f});
+    
+    EXPECT_FLOAT_EQ(distribution.mean_ms, 3.0f);
+    EXPECT_FLOAT_EQ(distribution.std_deviation_ms, std::sqrt(2.0f));
+    EXPECT_FLOAT_EQ(distribution.min_ms, 1.0f);
+    EXPECT_FLOAT_EQ(distribution.max_ms, 5.0f);
+    EXPECT_FLOAT_EQ(distribution.p50_ms, 3.0f);
+    EXPECT_FLOAT_EQ(distribution.p90_ms, 4.6f);
+    EXPECT_FLOAT_EQ(distribution.p99_ms, 4.96f);
+    EXPECT_FLOAT_EQ(distribution.mad_ms, 1.0f);
+    EXPECT_TRUE(distribution.outlier_indices.empty());
+    
+    // Raw samples keep execution order
+    EXPECT_EQ(distribution.samples_ms, (std::vector<float>{4.0f, 2.0f, 5.0f, 1.0f, 3.0f}));
+    
+    EXPECT_LE(distribution.mean_ci_low_ms, distribution.mean_ms);
+    EXPECT_GE(distribution.mean_ci_high_ms, distribution.mean_ms);
+    EXPECT_GE(distribution.mean_ci_low_ms, 1.0f);
+    EXPECT_LE(distribution.mean_ci_high_ms, 5.0f);
+}
+
+TEST(StatisticsTest, EmptySamplesGiveZeroDistribution) {
+    TimingDistribution distribution = SummarizeTimings({});
+    EXPECT_TRUE(distribution.samples_ms.empty());
+    EXPECT_EQ(distribution.mean_ms, 0.0f);
+    EXPECT_EQ(distribution.p50_ms, 0.0f);
+    EXPECT_EQ(distribution.mean_ci_high_ms, 0.0f);
+}
+
+TEST(StatisticsTest, FlagsOutliersPastModifiedZScoreCutoff) {
+    // Median 11 and MAD 1, so the cutoff 0.6745 * |x - 11| > 3.5 lies between 16 and 17
+    const std::vector<float> samples = {10.0f, 11.0f, 12.0f, 17.0f, 10.0f, 11.0f, 12.0f,
+                                        10.0f, 16.0f, 11.0f, 12.0f, 10.0f, 11.0f};
+    TimingDistribution distribution = SummarizeTimings(samples);
+    
+    EXPECT_FLOAT_EQ(distribution.p50_ms, 11.0f);
+    EXPECT_FLOAT_EQ(distribution.mad_ms, 1.0f);
+    EXPECT_EQ(distribution.outlier_indices, (std::vector<size_t>{3}));
+}
+
+TEST(StatisticsTest, ZeroMadFlagsNoOutliers) {
+    // More than half the samples are identical, so MAD is 0 and the z-score is undefined
+    TimingDistribution distribution = SummarizeTimings({5.0f, 5.0f, 5.0f, 50.0f, 5.0f, 5.0f, 5.0f});
+    
+    EXPECT_FLOAT_EQ(distribution.p50_ms, 5.0f);
+    EXPECT_EQ(distribution.mad_ms, 0.0f);
+    EXPECT_TRUE(distribution.outlier_indices.empty());
+    EXPECT_FLOAT_EQ(distribution.max_ms, 50.0f);
+}
+
+TEST(StatisticsTest, SingleSampleCollapsesEveryStatistic) {
+    TimingDistribution distribution = SummarizeTimings({4.0f});
+    
+    EXPECT_FLOAT_EQ(distribution.mean_ms, 4.0f);
+    EXPECT_EQ(distribution.std_deviation_ms, 0.0f);
+    EXPECT_FLOAT_EQ(distribution.min_ms, 4.0f);
+    EXPECT_FLOAT_EQ(distribution.max_ms, 4.0f);
+    EXPECT_FLOAT_EQ(distribution.p50_ms, 4.0f);
+    EXPECT_FLOAT_EQ(distribution.p999_ms, 4.0f);
+    EXPECT_EQ(distribution.mad_ms, 0.0f);
+    EXPECT_TRUE(distribution.outlier_indices.empty());
+    EXPECT_FLOAT_EQ(distribution.mean_ci_low_ms, 4.0f);
+    EXPECT_FLOAT_EQ(distribution.mean_ci_high_ms, 4.0f);
+    EXPECT_FLOAT_EQ(distribution.median_ci_low_ms, 4.0f);
+    EXPECT_FLOAT_EQ(distribution.median_ci_high_ms, 4.0f);
+}
+
+TEST(StatisticsTest, TwoSamplesSpanTheirRange) {
+    TimingDistribution distribution = SummarizeTimings({2.0f, 4.0f});
+    
+    EXPECT_FLOAT_EQ(distribution.mean_ms, 3.0f);
+    EXPECT_FLOAT_EQ(distribution.p50_ms, 3.0f);
+    EXPECT_FLOAT_EQ(distribution.p90_ms, 3.8f);  // Interpolated 90% of the way from 2 to 4
+    EXPECT_FLOAT_EQ(distribution.std_deviation_ms, 1.0f);
+    EXPECT_FLOAT_EQ(distribution.mad_ms, 1.0f);
+    EXPECT_TRUE(distribution.outlier_indices.empty());
+    
+    // A quarter of the resamples draw 2 twice and a quarter draw 4 twice, so the
+    // 2.5th and 97.5th percentiles of the resampled means are the samples themselves
+    EXPECT_FLOAT_EQ(distribution.mean_ci_low_ms, 2.0f);
+    EXPECT_FLOAT_EQ(distribution.mean_ci_high_ms, 4.0f);
+    EXPECT_FLOAT_EQ(distribution.median_ci_low_ms, 2.0f);
+    EXPECT_FLOAT_EQ(distribution.median_ci_high_ms, 4.0f);
+}
+
+TEST(StatisticsTest, BootstrapIntervalsAreReproducible) {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> jitter(0.0f, 1.0f);
+    std::vector<float> samples(200);
+    for (float& sample : samples) {
+        sample = 10.0f + jitter(generator);
+    }
+    
+    TimingDistribution first = SummarizeTimings(samples);
+    TimingDistribution second = SummarizeTimings(samples);
+    EXPECT_EQ(first.mean_ci_low_ms, second.mean_ci_low_ms);
+    EXPECT_EQ(first.mean_ci_high_ms, second.mean_ci_high_ms);
+    EXPECT_EQ(first.median_ci_low_ms, second.median_ci_low_ms);
+    EXPECT_EQ(first.median_ci_high_ms, second.median_ci_high_ms);
+    
+    // The intervals bracket their estimates and are narrower than the sample range
+    EXPECT_LT(first.mean_ci_low_ms, first.mean_ms);
+    EXPECT_GT(first.mean_ci_high_ms, first.mean_ms);
+    EXPECT_LE(first.median_ci_low_ms, first.p50_ms);
+    EXPECT_GE(first.median_ci_high_ms, first.p50_ms);
+    EXPECT_LT(first.mean_ci_high_ms - first.mean_ci_low_ms, 0.2f);
+}
+
+} // namespace kerntopia
@@ -0,0 +1,224 @@
+#include "core/backend/vulkan_memory.hpp"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <set>
+
+#ifdef KERNTOPIA_VULKAN_SDK_AVAILABLE
+
+namespace kerntopia {
+
+namespace {
+
+// Fake driver state: memory handles are counters, live handles are tracked for leak checks
+uint64_t g_next_memory = 1;
+std::set<uint64_t> g_live_memory;
+VkDeviceSize g_last_allocation_size = 0;
+
+VKAPI_ATTR void VKAPI_CALL FakeGetPhysicalDeviceMemoryProperties(VkPhysicalDevice, VkPhysicalDeviceMemoryProperties* properties) {
+    *properties = {};
+    properties->memoryTypeCount = 1;
+    properties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    properties->memoryTypes[0].heapIndex = 0;
+    properties->memoryHeapCount = 1;
+    properties->memoryHeaps[0].size = 1ull << 32;
+    properties->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL FakeAllocateMemory(VkDevice, const VkMemoryAllocateInfo* info, const VkAllocationCallbacks*,
+                                                  VkDeviceMemory* memory) {
+    uint64_t handle = g_next_memory++;
+    g_live_memory.insert(handle);
+    g_last_allocation_size = info->allocationSize;
+    *memory = reinterpret_cast<VkDeviceMemory>(static_cast<uintptr_t>(handle));
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL FakeFreeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks*) {
+    g_live_memory.erase(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(memory)));
+}
+
+VkMemoryRequirements Requirements(VkDeviceSize size, VkDeviceSize alignment = 1) {
+    VkMemoryRequirements requirements = {};
+    requirements.size = size;
+    requirements.alignment = alignment;
+    requirements.memoryTypeBits = 1;
+    return requirements;
+}
+
+} // namespace
+
+/**
+ * @brief Buddy allocator tests against a fake device with one device-local memory type
+ */
+class VulkanMemoryAllocatorTest : public ::testing::Test {
+protected:
+    using Allocator = VulkanMemoryAllocator;
+    
+    void SetUp() override {
+        saved_properties_ = vkGetPhysicalDeviceMemoryProperties;
+        saved_allocate_ = vkAllocateMemory;
+        saved_free_ = vkFreeMemory;
+        vkGetPhysicalDeviceMemoryProperties = FakeGetPhysicalDeviceMemoryProperties;
+        vkAllocateMemory = FakeAllocateMemory;
+        vkFreeMemory = FakeFreeMemory;
+        
+        g_next_memory = 1;
+        g_live_memory.clear();
+        g_last_allocation_size = 0;
+        
+        device_.logical_device = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(0x1000));
+        allocator_ = std::make_unique<Allocator>(&device_);
+    }
+    
+    void TearDown() override {
+        allocator_.reset();
+        EXPECT_TRUE(g_live_memory.empty()) << "allocator leaked device memory";
+        
+        vkGetPhysicalDeviceMemoryProperties = saved_properties_;
+        vkAllocateMemory = saved_allocate_;
+        vkFreeMemory = saved_free_;
+    }
+    
+    VulkanAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment = 1) {
+        auto result = allocator_->Allocate(Requirements(size, alignment), 0);
+        EXPECT_TRUE(result.HasValue()) << (result ? "" : result.GetError().message);
+        return result ? result.GetValue() : VulkanAllocation{};
+    }
+    
+    VulkanDevice device_;
+    std::unique_ptr<Allocator> allocator_;
+    
+private:
+    PFN_vkGetPhysicalDeviceMemoryProperties saved_properties_ = nullptr;
+    PFN_vkAllocateMemory saved_allocate_ = nullptr;
+    PFN_vkFreeMemory saved_free_ = nullptr;
+};
+
+TEST_F(VulkanMemoryAllocatorTest, SplitsBlockIntoBuddies) {
+    VulkanAllocation first = Allocate(Allocator::kMinAllocation);
+    EXPECT_FALSE(first.dedicated);
+    EXPECT_EQ(first.offset, 0u);
+    EXPECT_EQ(first.size, Allocator::kMinAllocation);
+    EXPECT_EQ(g_last_allocation_size, Allocator::kBlockSize);
+    
+    // Splitting leaves one free range per order; the largest is the upper half of the block
+    auto stats = allocator_->GetStats();
+    EXPECT_EQ(stats.block_count, 1u);
+    EXPECT_EQ(stats.used_bytes, Allocator::kMinAllocation);
+    EXPECT_EQ(stats.largest_free_bytes, Allocator::kBlockSize / 2);
+    
+    // The next requests take the buddies left by the split, in address order
+    VulkanAllocation second = Allocate(Allocator::kMinAllocation);
+    VulkanAllocation third = Allocate(2 * Allocator::kMinAllocation);
+    EXPECT_EQ(second.memory, first.memory);
+    EXPECT_EQ(second.offset, Allocator::kMinAllocation);
+    EXPECT_EQ(third.offset, 2 * Allocator::kMinAllocation);
+    EXPECT_EQ(third.size, 2 * Allocator::kMinAllocation);
+    
+    // Sizes between orders round up to the next power of two
+    VulkanAllocation rounded = Allocate(3 * Allocator::kMinAllocation);
+    EXPECT_EQ(rounded.size, 4 * Allocator::kMinAllocation);
+    EXPECT_EQ(rounded.requested_size, 3 * Allocator::kMinAllocation);
+    EXPECT_EQ(allocator_->GetStats().requested_bytes, 7 * Allocator::kMinAllocation);
+    
+    allocator_->Free(first);
+    allocator_->Free(second);
+    allocator_->Free(third);
+    allocator_->Free(rounded);
+}
+
+TEST_F(VulkanMemoryAllocatorTest, MergesBuddiesBackToFullBlock) {
+    std::vector<VulkanAllocation> allocations;
+    for (int i = 0; i < 5; ++i) {
+        allocations.push_back(Allocate(Allocator::kMinAllocation << i));
+    }
+    
+    // Free out of order so merges have to wait for both buddies
+    for (size_t i : {3u, 0u, 4u, 2u, 1u}) {
+        allocator_->Free(allocations[i]);
+    }
+    
+    auto stats = allocator_->GetStats();
+    EXPECT_EQ(stats.block_count, 1u);
+    EXPECT_EQ(stats.allocation_count, 0u);
+    EXPECT_EQ(stats.used_bytes, 0u);
+    EXPECT_EQ(stats.requested_bytes, 0u);
+    EXPECT_EQ(stats.largest_free_bytes, Allocator::kBlockSize);
+    EXPECT_FLOAT_EQ(stats.fragmentation, 0.0f);
+    
+    // The empty block is kept and a half-block request fits at its start
+    VulkanAllocation half = Allocate(Allocator::kBlockSize / 2);
+    EXPECT_FALSE(half.dedicated);
+    EXPECT_EQ(half.offset, 0u);
+    EXPECT_EQ(g_live_memory.size(), 1u);
+    allocator_->Free(half);
+}
+
+TEST_F(VulkanMemoryAllocatorTest, AlignmentRaisesOrder) {
+    VulkanAllocation small = Allocate(Allocator::kMinAllocation);
+    
+    // A 4 KiB alignment on a small request takes a 4 KiB range, aligned by construction
+    const VkDeviceSize alignment = 4096;
+    VulkanAllocation aligned = Allocate(100, alignment);
+    EXPECT_EQ(aligned.size, alignment);
+    EXPECT_EQ(aligned.requested_size, 100u);
+    EXPECT_EQ(aligned.offset % alignment, 0u);
+    EXPECT_EQ(aligned.offset, alignment);
+    
+    allocator_->Free(aligned);
+    allocator_->Free(small);
+}
+
+TEST_F(VulkanMemoryAllocatorTest, LargeRequestsGetDedicatedAllocations) {
+    VulkanAllocation half = Allocate(Allocator::kBlockSize / 2);
+    EXPECT_FALSE(half.dedicated);
+    
+    const VkDeviceSize size = Allocator::kBlockSize / 2 + 1;
+    VulkanAllocation large = Allocate(size);
+    EXPECT_TRUE(large.dedicated);
+    EXPECT_EQ(large.offset, 0u);
+    EXPECT_EQ(large.size, size);
+    EXPECT_EQ(g_last_allocation_size, size);
+    EXPECT_NE(large.memory, half.memory);
+    
+    auto stats = allocator_->GetStats();
+    EXPECT_EQ(stats.block_count, 1u);
+    EXPECT_EQ(stats.dedicated_count, 1u);
+    EXPECT_EQ(stats.dedicated_bytes, size);
+    EXPECT_EQ(stats.allocation_count, 2u);
+    
+    allocator_->Free(large);
+    EXPECT_EQ(allocator_->GetStats().dedicated_count, 0u);
+    EXPECT_EQ(g_live_memory.size(), 1u);
+    allocator_->Free(half);
+}
+
+TEST_F(VulkanMemoryAllocatorTest, FreeOfUnknownOffsetIsIgnored) {
+    VulkanAllocation first = Allocate(Allocator::kMinAllocation);
+    VulkanAllocation second = Allocate(Allocator::kMinAllocation);
+    auto before = allocator_->GetStats();
+    
+    // An offset inside the block that was never handed out
+    VulkanAllocation unknown = first;
+    unknown.offset = 64 * Allocator::kMinAllocation;
+    allocator_->Free(unknown);
+    
+    // A second free of the same allocation
+    allocator_->Free(first);
+    auto after_first = allocator_->GetStats();
+    allocator_->Free(first);
+    
+    auto after = allocator_->GetStats();
+    EXPECT_EQ(after.allocation_count, after_first.allocation_count);
+    EXPECT_EQ(after.used_bytes, after_first.used_bytes);
+    EXPECT_EQ(after_first.used_bytes, before.used_bytes - Allocator::kMinAllocation);
+    
+    // The surviving allocation is still tracked and frees normally
+    allocator_->Free(second);
+    EXPECT_EQ(allocator_->GetStats().used_bytes, 0u);
+    EXPECT_EQ(allocator_->GetStats().largest_free_bytes, Allocator::kBlockSize);
+}
+
+} // namespace kerntopia
+
+#endif // KERNTOPIA_VULKAN_SDK_AVAILABLE